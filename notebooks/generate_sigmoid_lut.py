@@ -0,0 +1,75 @@
+#!/usr/bin/env python
+
+# Generates the lookup table used by the sigmoid_lut RTL engine (sigmoid_rtl/src/rtl/sigmoid_lut_pkg.sv)
+# The table is indexed directly by the bits of the bf16 input: {sign, exponent - LUT_EXP_MIN, mantissa}
+# Every entry holds sigmoid(x) computed in double precision and rounded to nearest even bf16
+# Inputs outside of the [2^-8, 2^8) magnitude range don't need a table entry:
+# - |x| < 2^-8 always rounds to 0.5
+# - x >= 2^7 always rounds to 1.0 and x <= -2^7 always rounds to 0.0 (sigmoid(-128) is below the smallest bf16 denormal)
+import math
+import os
+import struct
+
+LUT_EXP_MIN = 119  # 2^-8
+LUT_EXP_MAX = 134  # [2^7, 2^8)
+LUT_ADDR_BITS = 1 + 4 + 7
+LUT_DEPTH = 2**LUT_ADDR_BITS
+
+OUTPUT_FILENAME = os.path.join(os.path.dirname(__file__), "..", "sigmoid_rtl", "src", "rtl", "sigmoid_lut_pkg.sv")
+
+def bf16_to_f64(bits):
+    return struct.unpack('>f', struct.pack('>I', bits << 16))[0]
+
+# Round a double to the nearest even bf16 value, including bf16 denormals
+def f64_to_bf16(value):
+    if value == 0.0:
+        return 0
+
+    # Spacing between bf16 values around our value. Denormals are evenly spaced by 2^-133
+    exponent = max(math.frexp(abs(value))[1] - 1, -126)
+    ulp = 2.0 ** (exponent - 7)
+    rounded = round(value / ulp) * ulp  # Python rounds halfway cases to even
+
+    return struct.unpack('>I', struct.pack('>f', rounded))[0] >> 16
+
+def sigmoid(x):
+    # Avoid overflowing exp() for large negative inputs
+    if x < 0:
+        return math.exp(x) / (1.0 + math.exp(x))
+    return 1.0 / (1.0 + math.exp(-x))
+
+def generate_table():
+    table = []
+
+    for index in range(LUT_DEPTH):
+        sign = index >> 11
+        exponent = ((index >> 7) & 0xF) + LUT_EXP_MIN
+        mantissa = index & 0x7F
+
+        x = bf16_to_f64((sign << 15) | (exponent << 7) | mantissa)
+        table.append(f64_to_bf16(sigmoid(x)))
+    return table
+
+def write_package(table, filename = OUTPUT_FILENAME):
+    entries_per_line = 8
+
+    with open(filename, "w") as file:
+        file.write("// Generated by notebooks/generate_sigmoid_lut.py, do not edit by hand\n")
+        file.write("// sigmoid(x) for every bf16 input with 2^-8 <= |x| < 2^8, rounded to nearest even\n")
+        file.write("// Indexed by {sign, exponent - SIGMOID_LUT_EXP_MIN, mantissa}\n")
+        file.write("package sigmoid_lut_pkg;\n")
+        file.write(f"  localparam int SIGMOID_LUT_EXP_MIN = {LUT_EXP_MIN};\n")
+        file.write(f"  localparam int SIGMOID_LUT_EXP_MAX = {LUT_EXP_MAX};\n")
+        file.write(f"  localparam int SIGMOID_LUT_ADDR_BITS = {LUT_ADDR_BITS};\n\n")
+        file.write(f"  localparam logic [15:0] SIGMOID_LUT [0:{LUT_DEPTH - 1}] = '{{\n")
+
+        for i in range(0, LUT_DEPTH, entries_per_line):
+            line = ", ".join(f"16'h{value:04X}" for value in table[i:i + entries_per_line])
+            separator = "," if i + entries_per_line < LUT_DEPTH else ""
+            file.write(f"    {line}{separator}\n")
+
+        file.write("  };\n")
+        file.write("endpackage : sigmoid_lut_pkg\n")
+
+if __name__ == "__main__":
+    write_package(generate_table())
@@ -27,12 +27,18 @@ class RTLTestbench:
                 floats.append(cls.bf16_to_f32(bf16))
         return np.array(floats)
 
+    # Round to the nearest bf16 value (ties to even), matching bf16::fromFloat in the C++ testbench
     @classmethod
     def f32_to_bf16(cls, f):
         f32_bytes = struct.pack('>f', f)    
         f32_int = struct.unpack('>I', f32_bytes)[0]
-        # Truncate mantissa
-        bf16_int = f32_int >> 16
+
+        if (f32_int & 0x7FFFFFFF) > 0x7F800000:
+            # NaN: keep the upper payload bits and make it quiet, so it can't turn into an infinity
+            bf16_int = (f32_int >> 16) | 0x40
+        else:
+            # Adding 0x7FFF rounds up when the discarded half is above 0x8000, the LSB of the result breaks ties
+            bf16_int = (f32_int + 0x7FFF + ((f32_int >> 16) & 1)) >> 16
         
         bf16_bytes = struct.pack('>H', bf16_int)
         return bf16_bytes.hex()
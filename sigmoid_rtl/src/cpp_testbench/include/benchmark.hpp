@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Benchmark {
+    // Run every bf16 input through each sigmoid engine and print latency, throughput and accuracy figures side by side
+    void compareEngines();
+}  // namespace Benchmark
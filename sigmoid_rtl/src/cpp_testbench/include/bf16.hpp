@@ -1,20 +1,33 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <optional>
-#include <sstream>
+#include <string_view>
 
 #include "helpers.hpp"
 
 // bfloat16 helpers
 namespace bf16 {
+    // Round a float to the nearest bf16 value, ties to even
+    // NaNs stay NaNs: their sign and upper payload bits are kept, and they're made quiet so truncating the payload can't turn them into infinities
+    // The batched kernels in bf16_convert.hpp implement the exact same rounding
     static u16 fromFloat(float f) {
         auto floatBits = std::bit_cast<u32>(f);
-        auto sign = (floatBits >> 31) & 0x1;
-        auto exponent = (floatBits >> 23) & 0xFF;
-        auto mantissa = floatBits & 0x7FFFFF;
 
-        return u16((sign << 15) | (exponent << 7) | ((mantissa >> 16) & 0x7F));
+        if ((floatBits & 0x7FFFFFFF) > 0x7F800000) {
+            return u16((floatBits >> 16) | 0x40);
+        }
+
+        // Adding 0x7FFF rounds up when the discarded half is above 0x8000, the LSB of the result breaks ties
+        // Carries propagate into the exponent, so rounding up the largest float correctly produces infinity
+        const u32 roundingBias = 0x7FFF + ((floatBits >> 16) & 1);
+        return u16((floatBits + roundingBias) >> 16);
     }
 
     static float toFloat(u16 bfloat) {
@@ -26,6 +39,19 @@ namespace bf16 {
         return std::bit_cast<float>(floatBits);
     }
 
+    // Round a double to the nearest bf16 value, ties to even. Handles denormals, infinities and NaNs
+    static u16 fromDouble(double d) {
+        if (std::isnan(d)) return 0x7FC0;
+        if (d == 0.0 || std::isinf(d)) return fromFloat(float(d));
+
+        // Spacing between bf16 values around d. Denormals are evenly spaced by 2^-133
+        const int exponent = std::max(std::ilogb(d), -126);
+        const double rounded = std::ldexp(std::nearbyint(std::ldexp(d, 7 - exponent)), exponent - 7);
+
+        // The rounded value is exactly representable as a bf16, so converting it to a float is exact too
+        return fromFloat(float(rounded));
+    }
+
     static u16 fromSignExpFrac(u16 sign, u16 exponent, u16 mantissa) {
         return u16((sign << 15) | (exponent << 7) | (mantissa & 0x7F));
     }
@@ -66,31 +92,102 @@ namespace bf16 {
         return exponent(bfloat) == 0 && mantissa(bfloat) == 0;
     }
 
-    static std::optional<u16> fromString(const std::string& str) {
-        std::istringstream stream(str);
+    // from_chars doesn't take a leading '+', so skip one ourselves. A sign after it, like "+-1", stays invalid
+    static bool skipPlusSign(std::string_view& str) {
+        if (!str.starts_with('+')) return true;
 
-        // First, try parsing the input as a 16-bit hex value. If that fails, try parsing it as a float
-        u16 hexValue;
+        str.remove_prefix(1);
+        return !str.starts_with('+') && !str.starts_with('-');
+    }
 
-        stream >> std::hex >> hexValue;
-        if (!stream.fail() && stream.eof()) {
-            return hexValue;
+    // Parse a 16-bit hex value, with an optional + sign and 0x prefix
+    static std::optional<u16> fromHexString(std::string_view str) {
+        if (!skipPlusSign(str)) return std::nullopt;
+        if (str.starts_with("0x") || str.starts_with("0X")) str.remove_prefix(2);
+
+        u16 value;
+        const char* end = str.data() + str.size();
+        const auto [ptr, error] = std::from_chars(str.data(), end, value, 16);
+
+        if (error == std::errc() && ptr == end && !str.empty()) {
+            return value;
         } else {
-            float floatValue;
+            return std::nullopt;
+        }
+    }
+
+    // Parse a decimal float, with an optional + or - sign, and round it to bf16
+    static std::optional<u16> fromFloatString(std::string_view str) {
+        if (!skipPlusSign(str)) return std::nullopt;
+
+        float value;
+
+#if defined(__cpp_lib_to_chars)
+        const char* end = str.data() + str.size();
+        const auto [ptr, error] = std::from_chars(str.data(), end, value);
+        const bool success = error == std::errc() && ptr == end && !str.empty();
+#else
+        // Standard libraries without floating point from_chars (eg libc++ before LLVM 20): strtof needs a null-terminated string
+        std::array<char, 64> buffer;
+        if (str.empty() || str.size() >= buffer.size()) return std::nullopt;
 
-            stream.clear();
-            stream.str(str);
-            stream >> floatValue;
+        std::copy(str.begin(), str.end(), buffer.begin());
+        buffer[str.size()] = '\0';
 
-            if (!stream.fail() && stream.eof()) {
-                return bf16::fromFloat(floatValue);
-            } else {
-                return std::nullopt;
-            }
+        char* ptr;
+        value = std::strtof(buffer.data(), &ptr);
+        const bool success = ptr == buffer.data() + str.size();
+#endif
+
+        if (success) {
+            return fromFloat(value);
+        } else {
+            return std::nullopt;
         }
     }
 
-    static std::optional<u16> fromString(const char* str) {
-        return fromString(std::string(str));
+    // Doesn't allocate, so it's safe to call every frame
+    static std::optional<u16> fromString(std::string_view str) {
+        // Ignore surrounding whitespace
+        const auto first = str.find_first_not_of(" \t\r\n");
+        if (first == std::string_view::npos) return std::nullopt;
+        str = str.substr(first, str.find_last_not_of(" \t\r\n") - first + 1);
+
+        // First, try parsing the input as a 16-bit hex value. If that fails, try parsing it as a float
+        if (const auto hexValue = fromHexString(str)) {
+            return hexValue;
+        } else {
+            return fromFloatString(str);
+        }
+    }
+
+    // Large enough for the longest value format() can produce: the largest bf16 has 39 integer digits
+    using FormatBuffer = std::array<char, 64>;
+
+    // Format a bf16 value as "HEX (float)" into a caller-provided buffer, without allocating
+    // The result is null-terminated, so the buffer can be handed to C APIs like ImGui directly
+    static std::string_view format(u16 bfloat, FormatBuffer& buffer) {
+        char* const begin = buffer.data();
+        char* const last = buffer.data() + buffer.size() - 1;  // Keep room for the null terminator
+        char* ptr = begin;
+
+        // Zero-padded, uppercase hex
+        constexpr char hexDigits[] = "0123456789ABCDEF";
+        for (int shift = 12; shift >= 0; shift -= 4) {
+            *ptr++ = hexDigits[(bfloat >> shift) & 0xF];
+        }
+
+        *ptr++ = ' ';
+        *ptr++ = '(';
+
+#if defined(__cpp_lib_to_chars)
+        ptr = std::to_chars(ptr, last - 1, toFloat(bfloat), std::chars_format::fixed, 4).ptr;
+#else
+        ptr += std::snprintf(ptr, usize(last - 1 - ptr), "%.4f", toFloat(bfloat));
+#endif
+
+        *ptr++ = ')';
+        *ptr = '\0';
+        return std::string_view(begin, ptr);
     }
 }  // namespace bf16
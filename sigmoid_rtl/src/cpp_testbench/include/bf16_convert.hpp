@@ -0,0 +1,14 @@
+#pragma once
+
+#include <span>
+
+#include "helpers.hpp"
+
+// Batched float32 <-> bfloat16 conversions
+// Results are bit-identical to bf16::fromFloat/bf16::toFloat (round to nearest even, quiet NaNs, denormals kept)
+// SIMD kernels are picked at runtime: AVX-512F or AVX2 on x86-64, NEON on AArch64, scalar everywhere else
+namespace bf16 {
+    // Convert min(input.size(), output.size()) values
+    void fromFloats(std::span<const float> input, std::span<u16> output);
+    void toFloats(std::span<const u16> input, std::span<float> output);
+}  // namespace bf16
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace MultiChannel {
+    // Drive every input of axis_sigmoid_mc under a few traffic patterns, check each result against the single-channel engine
+    // and print per-channel shares of the pipeline and aggregate throughput
+    void runFairnessTest();
+}  // namespace MultiChannel
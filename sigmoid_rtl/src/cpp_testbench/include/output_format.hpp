@@ -0,0 +1,118 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <span>
+#include <vector>
+
+#include "bf16.hpp"
+#include "helpers.hpp"
+#include "sigmoid_params.hpp"
+
+// Reduced precision output formats of axis_sigmoid (OUTPUT_FORMAT parameter)
+// Reference model of sigmoid_convert_output in rtl/sigmoid_pkg.sv, the format codes come from the same package
+namespace OutputFormat {
+    struct Info {
+        u32 format;
+        const char* name;
+        u32 width;  // Bits per result
+    };
+
+    static constexpr std::array<Info, 5> formats = {{
+        {SIGMOID_FORMAT_BF16, "BF16", 16},
+        {SIGMOID_FORMAT_UQ0_8, "UQ0.8", 8},
+        {SIGMOID_FORMAT_UQ0_16, "UQ0.16", 16},
+        {SIGMOID_FORMAT_FP8_E4M3, "FP8 E4M3", 8},
+        {SIGMOID_FORMAT_FP8_E5M2, "FP8 E5M2", 8},
+    }};
+
+    static constexpr bool isFixedPoint(u32 format) {
+        return format == SIGMOID_FORMAT_UQ0_8 || format == SIGMOID_FORMAT_UQ0_16;
+    }
+
+    static constexpr bool isFP8(u32 format) {
+        return format == SIGMOID_FORMAT_FP8_E4M3 || format == SIGMOID_FORMAT_FP8_E5M2;
+    }
+
+    static constexpr u32 width(u32 format) {
+        return (format == SIGMOID_FORMAT_BF16 || format == SIGMOID_FORMAT_UQ0_16) ? 16 : 8;
+    }
+
+    // value / 2^shift, rounded to nearest even
+    static constexpr u32 shiftRoundNearestEven(u32 value, s32 shift) {
+        if (shift <= 0) return value << -shift;
+        if (shift > 16) return 0;
+
+        const u32 quotient = value >> shift;
+        const u32 remainder = value & ((1u << shift) - 1);
+        const u32 half = 1u << (shift - 1);
+        return quotient + ((remainder > half || (remainder == half && (quotient & 1))) ? 1 : 0);
+    }
+
+    // Convert a bf16 sigmoid result, exactly like the hardware does
+    static u16 fromBf16(u32 format, u16 value) {
+        if (format == SIGMOID_FORMAT_BF16) return value;
+        if (bf16::isNAN(value)) return isFP8(format) ? 0x7F : 0;
+        if (bf16::sign(value) || bf16::exponent(value) == 0) return 0;
+
+        const s32 exponent = bf16::exponent(value);
+        const u32 significand = 0x80 | bf16::mantissa(value);
+
+        if (isFixedPoint(format)) {
+            const s32 fractionBits = s32(width(format));
+            const u32 maxCode = (1u << fractionBits) - 1;
+            const s32 shift = 127 + 7 - fractionBits - exponent;
+
+            if (exponent >= 127) return u16(maxCode);  // 1.0 and above
+            return u16(std::min(shiftRoundNearestEven(significand, shift), maxCode));
+        }
+
+        // FP8: Encodings are ordered like their values, so a rounding carry out of the significand bumps the exponent
+        const s32 fractionBits = (format == SIGMOID_FORMAT_FP8_E4M3) ? 3 : 2;
+        const s32 bias = (format == SIGMOID_FORMAT_FP8_E4M3) ? 7 : 15;
+        const u32 maxCode = (format == SIGMOID_FORMAT_FP8_E4M3) ? 0x7E : 0x7C;  // 448 for E4M3, infinity for E5M2
+        const s32 fp8Exponent = exponent - 127 + bias;
+
+        const u32 code = (fp8Exponent >= 1) ? (u32(fp8Exponent - 1) << fractionBits) + shiftRoundNearestEven(significand, 7 - fractionBits)
+                                            : shiftRoundNearestEven(significand, 8 - fractionBits - fp8Exponent);
+        return u16(std::min(code, maxCode));
+    }
+
+    // Decode a result back to a double
+    static f64 toDouble(u32 format, u16 code) {
+        if (format == SIGMOID_FORMAT_BF16) return bf16::toFloat(code);
+        if (isFixedPoint(format)) return std::ldexp(f64(code), -s32(width(format)));
+
+        const s32 fractionBits = (format == SIGMOID_FORMAT_FP8_E4M3) ? 3 : 2;
+        const s32 bias = (format == SIGMOID_FORMAT_FP8_E4M3) ? 7 : 15;
+        const s32 exponent = (code & 0x7F) >> fractionBits;
+        const u32 mantissa = code & ((1u << fractionBits) - 1);
+        const f64 sign = (code & 0x80) ? -1.0 : 1.0;
+
+        if (format == SIGMOID_FORMAT_FP8_E4M3 && (code & 0x7F) == 0x7F) return NAN;
+        if (format == SIGMOID_FORMAT_FP8_E5M2 && exponent == 0x1F) return mantissa ? NAN : sign * INFINITY;
+        if (exponent == 0) return sign * std::ldexp(f64(mantissa), 1 - bias - fractionBits);
+        return sign * std::ldexp(f64(mantissa | (1u << fractionBits)), exponent - bias - fractionBits);
+    }
+
+    // Split output beats into results. Results fill a beat from its least significant bits, keep has one bit per byte
+    // Only bytes with their keep bit set hold results, which lets the last beat of a packet be partially filled
+    // data and keep are given as 32-bit words, least significant first, so beats of any width can be unpacked
+    static void unpackBeat(u32 format, std::span<const u32> data, std::span<const u32> keep, u32 beatWidth, std::vector<u16>& results) {
+        const u32 lanes = beatWidth / width(format);
+        const u32 laneBytes = width(format) / 8;
+
+        for (u32 lane = 0; lane < lanes; lane++) {
+            const u32 keepBit = lane * laneBytes;
+            const u32 dataBit = lane * width(format);  // Lanes are 8 or 16 bits, so they never straddle 2 words
+
+            if (((keep[keepBit / 32] >> (keepBit % 32)) & 1) == 0) break;
+            results.push_back(u16((data[dataBit / 32] >> (dataBit % 32)) & ((1u << width(format)) - 1)));
+        }
+    }
+
+    // Stream every bf16 input through axis_sigmoid in each reduced precision format, check the unpacked results and packet
+    // boundaries against the reference model above and print output bandwidth and accuracy figures
+    void runPackingTest();
+}  // namespace OutputFormat
@@ -1,10 +1,98 @@
 #pragma once
 
+#include <array>
+#include <vector>
+
 #include "helpers.hpp"
+#include "sigmoid_axis_e4m3_t.h"
+#include "sigmoid_axis_e5m2_t.h"
+#include "sigmoid_axis_uq16_t.h"
+#include "sigmoid_axis_uq8_t.h"
+#include "sigmoid_axis_uq8_wide_t.h"
+#include "sigmoid_deep_f1_t.h"
+#include "sigmoid_deep_f3_t.h"
+#include "sigmoid_deep_t.h"
+#include "sigmoid_lut_t.h"
+#include "sigmoid_mc_t.h"
+#include "sigmoid_mc_weighted_t.h"
+#include "sigmoid_params.hpp"
 #include "sigmoid_t.h"
 #include "sigmoid_t___024root.h"
+#include "sigmoid_toggle_isolated_t.h"
+#include "sigmoid_toggle_t.h"
 
 using Sigmoid = sigmoid_t;
-static constexpr u32 PIPELINE_STAGES = 6;
+using SigmoidLUT = sigmoid_lut_t;
+using SigmoidDeep = sigmoid_deep_t;
+
+// sigmoid_pipelined_deep with FPU_STAGES overridden to 1 and 3 cycles
+using SigmoidDeepF1 = sigmoid_deep_f1_t;
+using SigmoidDeepF3 = sigmoid_deep_f3_t;
+
+// sigmoid_pipelined with toggle coverage, without and with OPERAND_ISOLATION
+using SigmoidToggle = sigmoid_toggle_t;
+using SigmoidToggleIsolated = sigmoid_toggle_isolated_t;
+
+// axis_sigmoid_mc, verilated with plain and weighted round robin arbitration. Channel count and weights come from CMakeLists.txt
+using SigmoidMultiChannel = sigmoid_mc_t;
+using SigmoidMultiChannelWeighted = sigmoid_mc_weighted_t;
+static constexpr u32 MC_CHANNELS = SIGMOID_MC_CHANNELS;
+static constexpr std::array<u32, MC_CHANNELS> MC_WEIGHTS = {SIGMOID_MC_WEIGHTS};
+
+// axis_sigmoid, verilated with each reduced precision output format (see output_format.hpp) and AXIS_BEAT_WIDTH-bit output beats
+using SigmoidAxisUQ8 = sigmoid_axis_uq8_t;
+using SigmoidAxisUQ16 = sigmoid_axis_uq16_t;
+using SigmoidAxisE4M3 = sigmoid_axis_e4m3_t;
+using SigmoidAxisE5M2 = sigmoid_axis_e5m2_t;
+static constexpr u32 AXIS_BEAT_WIDTH = SIGMOID_AXIS_BEAT_WIDTH;
+
+// axis_sigmoid with UQ0.8 results and AXIS_WIDE_BEAT_WIDTH-bit beats, where tdata and tkeep no longer fit in 32-bit words
+using SigmoidAxisUQ8Wide = sigmoid_axis_uq8_wide_t;
+static constexpr u32 AXIS_WIDE_BEAT_WIDTH = SIGMOID_AXIS_WIDE_BEAT_WIDTH;
+
+// Latencies come from rtl/sigmoid_pkg.sv, through the header CMake generates from it
+static constexpr u32 PIPELINE_STAGES = SIGMOID_POLY_LATENCY;
+static constexpr u32 LUT_PIPELINE_STAGES = SIGMOID_LUT_LATENCY;
+static constexpr u32 DEEP_PIPELINE_STAGES = SIGMOID_DEEP_LATENCY;
+
+// Mirrors sigmoid_deep_latency() in sigmoid_pkg.sv, for the deep engines verilated with other FPU_STAGES values
+constexpr u32 deepPipelineStages(u32 fpuStages) { return SIGMOID_DEEP_FIXED_STAGES + SIGMOID_DEEP_FPU_DEPTH * fpuStages; }
+
+// Works with any of our verilated sigmoid engines, since they all share the same ports
+template <typename Engine>
+void stepCycles(Engine* top, uint cycles) {
+    while (cycles > 0) {
+        top->clk = 0;
+        top->eval();
+
+        top->clk = 1;
+        top->eval();
+
+        cycles--;
+    }
+}
+
+// Results of the polynomial engine for every bf16 input, indexed by input. The AXI-Stream wrappers have to reproduce them exactly
+inline std::vector<u16> polynomialResults() {
+    auto ctx = new VerilatedContext();
+    auto top = new Sigmoid(ctx, "TOP");
+    std::vector<u16> results;
+    results.reserve(1 << 16);
+
+    top->rst = 1;
+    top->valid_in = 0;
+    stepCycles(top, 10);
+    top->rst = 0;
+
+    for (u32 input = 0; results.size() < (1 << 16); input++) {
+        top->valid_in = input < (1 << 16);
+        top->data_in = u16(input);
+        stepCycles(top, 1);
+
+        if (top->valid_out) results.push_back(top->data_out);
+    }
 
-void stepCycles(Sigmoid* top, uint cycles);
\ No newline at end of file
+    delete top;
+    delete ctx;
+    return results;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace ToggleReport {
+    // Run sigmoid_pipelined with and without operand isolation under idle, bursty and saturated traffic, and print the toggle
+    // counts of each pipeline stage from Verilator's toggle coverage, as a stand-in for dynamic power
+    void compareOperandIsolation();
+}  // namespace ToggleReport
@@ -0,0 +1,238 @@
+#include "benchmark.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "bf16.hpp"
+#include "bf16_convert.hpp"
+#include "helpers.hpp"
+#include "sigmoid.hpp"
+
+namespace {
+    // Accuracy bounds of the polynomial engines. sigmoid(x) drops below 2^-7 for x < -4.8, where the result is 1 - p(|x|)
+    // with p(|x|) close to 1, so it's quantized to steps of 2^-8 and can collapse to 0. bf16 ULPs shrink towards 0, so ULP
+    // errors are only bounded where the correctly rounded result is at least POLYNOMIAL_ULP_FLOOR. A bf16 emulation of the
+    // datapath gives a worst case of 60 ULP there (x = -4.8125), the bound leaves room for the FPUs rounding differently
+    constexpr f64 POLYNOMIAL_ULP_FLOOR = 1.0 / 128.0;
+    constexpr u32 POLYNOMIAL_MAX_ULP = 96;
+    constexpr f64 POLYNOMIAL_MAX_ABS_ERROR = 1.0 / 128.0;
+
+    struct EngineStats {
+        const char* name;
+
+        u32 latency = 0;           // Cycles from an input being accepted to its result showing up on data_out
+        f64 resultsPerCycle = 0.0;  // Sustained throughput when valid_in is held high
+
+        u32 testedInputs = 0;
+        u32 exactResults = 0;  // Results identical to the correctly rounded bf16 sigmoid
+        u32 maxUlpError = 0;
+        u16 worstInput = 0;  // Input with the largest ULP error
+
+        // Same, only over inputs whose correctly rounded result is at least POLYNOMIAL_ULP_FLOOR
+        u32 maxUlpErrorAboveFloor = 0;
+        u16 worstInputAboveFloor = 0;
+
+        f64 maxAbsError = 0.0;
+        f64 meanAbsError = 0.0;
+
+        std::vector<u16> outputs;  // Results for every tested input, in order
+    };
+
+    // Correctly rounded sigmoid, computed in double precision
+    u16 referenceSigmoid(u16 input) {
+        const f64 x = bf16::toFloat(input);
+        return bf16::fromDouble(1.0 / (1.0 + std::exp(-x)));
+    }
+
+    // Distance between 2 bf16 values in units in the last place
+    u32 ulpDistance(u16 a, u16 b) {
+        // Map sign-magnitude bf16 values to integers that are ordered like the values they represent
+        const auto toOrdered = [](u16 value) { return bf16::sign(value) ? -s32(value & 0x7FFF) : s32(value); };
+        return u32(std::abs(toOrdered(a) - toOrdered(b)));
+    }
+
+    template <typename Engine>
+    void reset(Engine* top) {
+        top->rst = 1;
+        top->valid_in = 0;
+        stepCycles(top, 10);
+
+        top->rst = 0;
+        stepCycles(top, 10);
+    }
+
+    // Push a single input into an idle pipeline and count the cycles until it comes out
+    template <typename Engine>
+    u32 measureLatency(Engine* top) {
+        constexpr u32 maxCycles = 1000;
+        u32 cycles = 1;
+
+        reset(top);
+        top->data_in = bf16::fromFloat(1.0f);
+        top->valid_in = 1;
+        stepCycles(top, 1);
+        top->valid_in = 0;
+
+        while (!top->valid_out && cycles < maxCycles) {
+            stepCycles(top, 1);
+            cycles++;
+        }
+
+        return cycles;
+    }
+
+    template <typename Engine>
+    EngineStats measureEngine(const char* name, u32 expectedLatency) {
+        EngineStats stats{.name = name};
+        auto ctx = new VerilatedContext();
+        auto top = new Engine(ctx, "TOP");
+
+        // The wrappers size their sideband delay lines from sigmoid_pkg.sv, so the RTL has to match it exactly
+        stats.latency = measureLatency(top);
+        if (stats.latency != expectedLatency) {
+            fmt::print("{}: expected a latency of {} cycles, measured {}\n", name, expectedLatency, stats.latency);
+            std::abort();
+        }
+
+        // Stream every non-NaN bf16 value back-to-back, collecting results as they come out
+        std::vector<u16> inputs;
+        std::vector<u16> outputs;
+        inputs.reserve(1 << 16);
+        outputs.reserve(1 << 16);
+
+        for (u32 value = 0; value < (1 << 16); value++) {
+            if (!bf16::isNAN(u16(value))) inputs.push_back(u16(value));
+        }
+
+        reset(top);
+        u64 cycles = 0;
+
+        for (u16 input : inputs) {
+            top->data_in = input;
+            top->valid_in = 1;
+            stepCycles(top, 1);
+            cycles++;
+
+            if (top->valid_out) outputs.push_back(top->data_out);
+        }
+
+        top->valid_in = 0;
+        while (outputs.size() < inputs.size() && cycles < inputs.size() + 1000) {
+            stepCycles(top, 1);
+            cycles++;
+
+            if (top->valid_out) outputs.push_back(top->data_out);
+        }
+
+        if (outputs.size() != inputs.size()) {
+            fmt::print("{}: expected {} results, got {}\n", name, inputs.size(), outputs.size());
+            std::abort();
+        }
+
+        stats.resultsPerCycle = f64(outputs.size()) / f64(cycles);
+
+        // Compare against the correctly rounded sigmoid
+        std::vector<u16> expected(inputs.size());
+        std::transform(inputs.begin(), inputs.end(), expected.begin(), referenceSigmoid);
+
+        std::vector<f32> outputFloats(outputs.size());
+        std::vector<f32> expectedFloats(expected.size());
+        bf16::toFloats(outputs, outputFloats);
+        bf16::toFloats(expected, expectedFloats);
+
+        f64 totalAbsError = 0.0;
+        for (usize i = 0; i < inputs.size(); i++) {
+            const u32 ulpError = ulpDistance(outputs[i], expected[i]);
+            // A NaN result has to count as the worst error possible, not get skipped by std::max
+            const f64 absError = bf16::isNAN(outputs[i]) ? INFINITY : std::abs(f64(outputFloats[i]) - f64(expectedFloats[i]));
+
+            stats.testedInputs++;
+            if (ulpError == 0) stats.exactResults++;
+            if (ulpError > stats.maxUlpError) {
+                stats.maxUlpError = ulpError;
+                stats.worstInput = inputs[i];
+            }
+
+            if (expectedFloats[i] >= POLYNOMIAL_ULP_FLOOR && ulpError > stats.maxUlpErrorAboveFloor) {
+                stats.maxUlpErrorAboveFloor = ulpError;
+                stats.worstInputAboveFloor = inputs[i];
+            }
+
+            stats.maxAbsError = std::max(stats.maxAbsError, absError);
+            totalAbsError += absError;
+        }
+
+        stats.meanAbsError = totalAbsError / f64(stats.testedInputs);
+        stats.outputs = std::move(outputs);
+
+        delete top;
+        delete ctx;
+        return stats;
+    }
+}  // namespace
+
+void Benchmark::compareEngines() {
+    const EngineStats engines[] = {
+        measureEngine<Sigmoid>("Polynomial", PIPELINE_STAGES),
+        measureEngine<SigmoidLUT>("LUT", LUT_PIPELINE_STAGES),
+        measureEngine<SigmoidDeep>("Deep", DEEP_PIPELINE_STAGES),
+        measureEngine<SigmoidDeepF1>("Deep (F=1)", deepPipelineStages(1)),
+        measureEngine<SigmoidDeepF3>("Deep (F=3)", deepPipelineStages(3)),
+    };
+
+    // The deep pipelines only retime the polynomial engine, so their results have to be bit-identical whatever FPU_STAGES is
+    const auto& polynomial = engines[0];
+    const auto deepEngines = {&engines[2], &engines[3], &engines[4]};
+    for (const auto* deep : deepEngines) {
+        for (usize i = 0; i < polynomial.outputs.size(); i++) {
+            if (polynomial.outputs[i] != deep->outputs[i]) {
+                fmt::print(
+                    "{} engine result {:04X} differs from the polynomial engine's {:04X}\n", deep->name, deep->outputs[i], polynomial.outputs[i]
+                );
+                std::abort();
+            }
+        }
+    }
+
+    fmt::print("Inputs: all {} non-NaN bfloat16 values\n\n", engines[0].testedInputs);
+    fmt::print(
+        "{:<12} {:>8} {:>14} {:>14} {:>9} {:>12} {:>14} {:>14}\n", "Engine", "Latency", "Results/cycle", "Exact", "Max ULP", "Worst input",
+        "Max abs error", "Mean abs error"
+    );
+
+    for (const auto& engine : engines) {
+        const std::string exact = fmt::format("{:.2f}%", 100.0 * engine.exactResults / engine.testedInputs);
+        fmt::print(
+            "{:<12} {:>8} {:>14.4f} {:>14} {:>9} {:>12} {:>14.3e} {:>14.3e}\n", engine.name, engine.latency, engine.resultsPerCycle, exact,
+            engine.maxUlpError, fmt::format("{:04X}", engine.worstInput), engine.maxAbsError, engine.meanAbsError
+        );
+    }
+
+    // The LUT holds the correctly rounded sigmoid, and its bypassed inputs round to constants, so every result has to be exact
+    const auto& lut = engines[1];
+    if (lut.exactResults != lut.testedInputs) {
+        fmt::print("LUT engine: only {} of {} results are correctly rounded\n", lut.exactResults, lut.testedInputs);
+        std::abort();
+    }
+
+    for (const auto* engine : {&engines[0], &engines[2], &engines[3], &engines[4]}) {
+        if (engine->maxAbsError > POLYNOMIAL_MAX_ABS_ERROR) {
+            fmt::print("{} engine: max abs error of {:.3e}, bound is {:.3e}\n", engine->name, engine->maxAbsError, POLYNOMIAL_MAX_ABS_ERROR);
+            std::abort();
+        }
+
+        if (engine->maxUlpErrorAboveFloor > POLYNOMIAL_MAX_ULP) {
+            fmt::print(
+                "{} engine: max error of {} ULP (input {:04X}) on results >= {}, bound is {} ULP\n", engine->name, engine->maxUlpErrorAboveFloor,
+                engine->worstInputAboveFloor, POLYNOMIAL_ULP_FLOOR, POLYNOMIAL_MAX_ULP
+            );
+            std::abort();
+        }
+    }
+}
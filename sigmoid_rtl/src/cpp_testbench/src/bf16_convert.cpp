@@ -0,0 +1,156 @@
+#include "bf16_convert.hpp"
+
+#include <algorithm>
+
+#include "bf16.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BF16_X86_KERNELS
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define BF16_NEON_KERNELS
+#endif
+
+// The SIMD kernels vectorize the integer rounding used by bf16::fromFloat, rather than using dedicated conversion instructions:
+// F16C only handles IEEE half precision, and AVX-512 BF16's VCVTNEPS2BF16 always flushes denormals to zero,
+// which would make results differ from the scalar path (and from our RTL, which does produce bf16 denormals)
+// Each kernel converts as many elements as it can in full vectors and returns that count, the caller handles the rest
+
+namespace {
+#if defined(BF16_X86_KERNELS)
+    __attribute__((target("avx2"))) __m256i roundToBf16AVX2(__m256i bits) {
+        const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(1));
+        const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(bits, _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7FFF))), 16);
+        const __m256i quietNaN = _mm256_or_si256(_mm256_srli_epi32(bits, 16), _mm256_set1_epi32(0x40));
+        const __m256i isNaN = _mm256_cmpgt_epi32(_mm256_and_si256(bits, _mm256_set1_epi32(0x7FFFFFFF)), _mm256_set1_epi32(0x7F800000));
+
+        return _mm256_blendv_epi8(rounded, quietNaN, isNaN);
+    }
+
+    __attribute__((target("avx2"))) usize fromFloatsAVX2(const float* input, u16* output, usize count) {
+        usize i = 0;
+
+        for (; i + 16 <= count; i += 16) {
+            const __m256i low = roundToBf16AVX2(_mm256_castps_si256(_mm256_loadu_ps(input + i)));
+            const __m256i high = roundToBf16AVX2(_mm256_castps_si256(_mm256_loadu_ps(input + i + 8)));
+
+            // packus works within 128-bit lanes, so the 64-bit chunks need to be put back in order afterwards
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), 0b11'01'10'00);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), packed);
+        }
+
+        return i;
+    }
+
+    __attribute__((target("avx2"))) usize toFloatsAVX2(const u16* input, float* output, usize count) {
+        usize i = 0;
+
+        for (; i + 8 <= count; i += 8) {
+            const __m256i widened = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)));
+            _mm256_storeu_ps(output + i, _mm256_castsi256_ps(_mm256_slli_epi32(widened, 16)));
+        }
+
+        return i;
+    }
+
+    __attribute__((target("avx512f"))) usize fromFloatsAVX512(const float* input, u16* output, usize count) {
+        usize i = 0;
+
+        for (; i + 16 <= count; i += 16) {
+            const __m512i bits = _mm512_castps_si512(_mm512_loadu_ps(input + i));
+            const __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(1));
+            const __m512i rounded = _mm512_srli_epi32(_mm512_add_epi32(bits, _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7FFF))), 16);
+            const __m512i quietNaN = _mm512_or_si512(_mm512_srli_epi32(bits, 16), _mm512_set1_epi32(0x40));
+            const __mmask16 isNaN = _mm512_cmpgt_epi32_mask(_mm512_and_si512(bits, _mm512_set1_epi32(0x7FFFFFFF)), _mm512_set1_epi32(0x7F800000));
+
+            const __m512i result = _mm512_mask_blend_epi32(isNaN, rounded, quietNaN);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm512_cvtepi32_epi16(result));
+        }
+
+        return i;
+    }
+
+    __attribute__((target("avx512f"))) usize toFloatsAVX512(const u16* input, float* output, usize count) {
+        usize i = 0;
+
+        for (; i + 16 <= count; i += 16) {
+            const __m512i widened = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)));
+            _mm512_storeu_ps(output + i, _mm512_castsi512_ps(_mm512_slli_epi32(widened, 16)));
+        }
+
+        return i;
+    }
+#elif defined(BF16_NEON_KERNELS)
+    uint32x4_t roundToBf16NEON(uint32x4_t bits) {
+        const uint32x4_t lsb = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+        const uint32x4_t rounded = vshrq_n_u32(vaddq_u32(bits, vaddq_u32(lsb, vdupq_n_u32(0x7FFF))), 16);
+        const uint32x4_t quietNaN = vorrq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(0x40));
+        const uint32x4_t isNaN = vcgtq_u32(vandq_u32(bits, vdupq_n_u32(0x7FFFFFFF)), vdupq_n_u32(0x7F800000));
+
+        return vbslq_u32(isNaN, quietNaN, rounded);
+    }
+
+    usize fromFloatsNEON(const float* input, u16* output, usize count) {
+        usize i = 0;
+
+        for (; i + 8 <= count; i += 8) {
+            const uint32x4_t low = roundToBf16NEON(vreinterpretq_u32_f32(vld1q_f32(input + i)));
+            const uint32x4_t high = roundToBf16NEON(vreinterpretq_u32_f32(vld1q_f32(input + i + 4)));
+            vst1q_u16(output + i, vcombine_u16(vmovn_u32(low), vmovn_u32(high)));
+        }
+
+        return i;
+    }
+
+    usize toFloatsNEON(const u16* input, float* output, usize count) {
+        usize i = 0;
+
+        for (; i + 8 <= count; i += 8) {
+            const uint16x8_t values = vld1q_u16(input + i);
+            vst1q_f32(output + i, vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(values), 16)));
+            vst1q_f32(output + i + 4, vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(values), 16)));
+        }
+
+        return i;
+    }
+#endif
+}  // namespace
+
+void bf16::fromFloats(std::span<const float> input, std::span<u16> output) {
+    const usize count = std::min(input.size(), output.size());
+    usize converted = 0;
+
+#if defined(BF16_X86_KERNELS)
+    if (__builtin_cpu_supports("avx512f")) {
+        converted = fromFloatsAVX512(input.data(), output.data(), count);
+    } else if (__builtin_cpu_supports("avx2")) {
+        converted = fromFloatsAVX2(input.data(), output.data(), count);
+    }
+#elif defined(BF16_NEON_KERNELS)
+    converted = fromFloatsNEON(input.data(), output.data(), count);
+#endif
+
+    for (usize i = converted; i < count; i++) {
+        output[i] = fromFloat(input[i]);
+    }
+}
+
+void bf16::toFloats(std::span<const u16> input, std::span<float> output) {
+    const usize count = std::min(input.size(), output.size());
+    usize converted = 0;
+
+#if defined(BF16_X86_KERNELS)
+    if (__builtin_cpu_supports("avx512f")) {
+        converted = toFloatsAVX512(input.data(), output.data(), count);
+    } else if (__builtin_cpu_supports("avx2")) {
+        converted = toFloatsAVX2(input.data(), output.data(), count);
+    }
+#elif defined(BF16_NEON_KERNELS)
+    converted = toFloatsNEON(input.data(), output.data(), count);
+#endif
+
+    for (usize i = converted; i < count; i++) {
+        output[i] = toFloat(input[i]);
+    }
+}
@@ -0,0 +1,265 @@
+#include "multichannel.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "helpers.hpp"
+#include "sigmoid.hpp"
+
+namespace {
+    // Per-channel fields are packed into one port each, channel 0 in the lowest bits
+    constexpr u32 CHANNEL_WIDTH = std::max<u32>(1, std::bit_width(MC_CHANNELS - 1));
+    static_assert(MC_CHANNELS * 16 <= 64, "tdata ports of more than 4 channels don't fit in the 64-bit words used here");
+
+    constexpr u32 PACKET_LENGTH = 16;
+    constexpr u32 TEST_CYCLES = 20000;
+    constexpr u32 DRAIN_CYCLES = 1000;  // Upper bound on emptying the FIFOs and pipeline once inputs stop
+
+    u64 getField(u64 word, u32 index, u32 width) {
+        return (word >> (index * width)) & ((u64(1) << width) - 1);
+    }
+
+    void setField(u64& word, u32 index, u32 width, u64 value) {
+        word |= (value & ((u64(1) << width) - 1)) << (index * width);
+    }
+
+    struct Scenario {
+        const char* name;
+        bool weighted;                           // Use the weighted round robin build instead of plain round robin
+        bool checkFairness;                      // Every channel is saturated, so shares have to follow the weights
+        std::array<u32, MC_CHANNELS> dest;       // Output each input channel sends its packets to
+        std::array<f64, MC_CHANNELS> load;       // Chance of an input producing a new beat on a given cycle
+        std::array<f64, MC_CHANNELS> readiness;  // Chance of an output asserting tready on a given cycle
+    };
+
+    struct Beat {
+        u16 data;
+        bool last;
+        u32 dest;
+    };
+
+    struct ChannelState {
+        bool hasBeat = false;  // tvalid is held high until the beat is accepted
+        Beat beat{};
+        u32 beatInPacket = 0;
+        std::deque<Beat> inFlight;  // Accepted beats whose results haven't come out yet
+
+        u64 beatsIn = 0;
+        u64 beatsOut = 0;
+    };
+
+    [[noreturn]] void fail(const Scenario& scenario, const std::string& message) {
+        fmt::print("{}: {}\n", scenario.name, message);
+        std::abort();
+    }
+
+    template <typename Top>
+    void runScenario(const Scenario& scenario, const std::vector<u16>& reference) {
+        auto ctx = new VerilatedContext();
+        auto top = new Top(ctx, "TOP");
+
+        std::mt19937 rng(1234);
+        std::uniform_int_distribution<u32> randomData(0, 0xFFFF);
+        std::uniform_real_distribution<f64> chance(0.0, 1.0);
+        std::array<ChannelState, MC_CHANNELS> channels;
+
+        const auto step = [&top]() {
+            top->aclk = 0;
+            top->eval();
+            top->aclk = 1;
+            top->eval();
+        };
+
+        top->aresetn = 0;
+        top->s_axis_tvalid = 0;
+        top->m_axis_tready = 0;
+        for (int i = 0; i < 10; i++) step();
+        top->aresetn = 1;
+
+        // While draining every output is ready and no new packets start. The arbiter keeps its grant until a packet's tlast,
+        // so channels in the middle of a packet keep sending beats until they finish it
+        const auto runCycle = [&](bool draining) {
+            // Drive inputs
+            u64 tdata = 0, tdest = 0, tlast = 0, tvalid = 0, tready = 0;
+
+            for (u32 i = 0; i < MC_CHANNELS; i++) {
+                auto& channel = channels[i];
+
+                const bool startsPacket = channel.beatInPacket == 0;
+                if (!channel.hasBeat && (draining ? !startsPacket : chance(rng) < scenario.load[i])) {
+                    channel.hasBeat = true;
+                    channel.beat = {.data = u16(randomData(rng)), .last = channel.beatInPacket == PACKET_LENGTH - 1, .dest = scenario.dest[i]};
+                }
+
+                setField(tdata, i, 16, channel.beat.data);
+                setField(tdest, i, CHANNEL_WIDTH, channel.beat.dest);
+                setField(tlast, i, 1, channel.beat.last);
+                setField(tvalid, i, 1, channel.hasBeat);
+                setField(tready, i, 1, draining || chance(rng) < scenario.readiness[i]);
+            }
+
+            top->s_axis_tdata = tdata;
+            top->s_axis_tdest = tdest;
+            top->s_axis_tlast = tlast;
+            top->s_axis_tvalid = tvalid;
+            top->m_axis_tready = tready;
+
+            // Settle combinational logic, then sample handshakes as they'll be seen by the rising edge
+            top->aclk = 0;
+            top->eval();
+
+            for (u32 i = 0; i < MC_CHANNELS; i++) {
+                auto& channel = channels[i];
+
+                if (channel.hasBeat && getField(top->s_axis_tready, i, 1)) {
+                    channel.inFlight.push_back(channel.beat);
+                    channel.hasBeat = false;
+                    channel.beatInPacket = channel.beat.last ? 0 : channel.beatInPacket + 1;
+                    channel.beatsIn++;
+                }
+
+                if (getField(top->m_axis_tvalid, i, 1) && getField(tready, i, 1)) {
+                    const u32 source = getField(top->m_axis_tid, i, CHANNEL_WIDTH);
+                    const u16 data = getField(top->m_axis_tdata, i, 16);
+                    const bool last = getField(top->m_axis_tlast, i, 1);
+
+                    if (source >= MC_CHANNELS || channels[source].inFlight.empty()) {
+                        fail(scenario, fmt::format("output {} produced a result for channel {}, which has none in flight", i, source));
+                    }
+
+                    const Beat expected = channels[source].inFlight.front();
+                    channels[source].inFlight.pop_front();
+                    channels[source].beatsOut++;
+
+                    if (expected.dest != i || getField(top->m_axis_tdest, i, CHANNEL_WIDTH) != i) {
+                        fail(scenario, fmt::format("channel {} result routed to output {}, expected {}", source, i, expected.dest));
+                    }
+
+                    if (data != reference[expected.data] || last != expected.last) {
+                        fail(
+                            scenario, fmt::format(
+                                          "channel {}: input {:04X} gave {:04X} (tlast {}), expected {:04X} (tlast {})", source, expected.data, data,
+                                          last, reference[expected.data], expected.last
+                                      )
+                        );
+                    }
+                }
+            }
+
+            top->aclk = 1;
+            top->eval();
+        };
+
+        for (u32 cycle = 0; cycle < TEST_CYCLES; cycle++) runCycle(false);
+
+        // Drain, then every packet must be complete and every accepted beat must have come out of the output its tdest picked,
+        // tagged with its tid
+        const auto pending = [&channels]() {
+            return std::any_of(channels.begin(), channels.end(), [](const ChannelState& c) { return c.hasBeat || c.beatInPacket != 0 || !c.inFlight.empty(); });
+        };
+
+        for (u32 cycle = 0; cycle < DRAIN_CYCLES && pending(); cycle++) runCycle(true);
+
+        for (u32 i = 0; i < MC_CHANNELS; i++) {
+            if (channels[i].hasBeat || channels[i].beatInPacket != 0 || channels[i].beatsIn != channels[i].beatsOut) {
+                fail(
+                    scenario, fmt::format(
+                                  "channel {}: {} beats accepted, {} results emitted and {} beats into a packet after draining for {} cycles", i,
+                                  channels[i].beatsIn, channels[i].beatsOut, channels[i].beatInPacket, DRAIN_CYCLES
+                              )
+                );
+            }
+        }
+
+        // Report shares of the pipeline, normalized by weight for the fairness index
+        u64 totalBeats = 0;
+        u32 totalWeight = 0;
+        u32 maxWeight = 0;
+        f64 sum = 0.0, sumSquares = 0.0;
+
+        const auto weightOf = [&scenario](u32 channel) { return scenario.weighted ? MC_WEIGHTS[channel] : 1; };
+
+        for (u32 i = 0; i < MC_CHANNELS; i++) {
+            const f64 normalized = f64(channels[i].beatsIn) / weightOf(i);
+            totalBeats += channels[i].beatsIn;
+            totalWeight += weightOf(i);
+            maxWeight = std::max(maxWeight, weightOf(i));
+            sum += normalized;
+            sumSquares += normalized * normalized;
+        }
+
+        const f64 throughput = f64(totalBeats) / TEST_CYCLES;
+        const f64 fairness = sumSquares > 0.0 ? (sum * sum) / (MC_CHANNELS * sumSquares) : 0.0;
+
+        fmt::print("{}\n", scenario.name);
+        fmt::print("{:>8} {:>7} {:>7} {:>7} {:>10} {:>10} {:>9}\n", "Channel", "Weight", "Load", "Output", "Beats in", "Beats out", "Share");
+
+        for (u32 i = 0; i < MC_CHANNELS; i++) {
+            const std::string share = fmt::format("{:.2f}%", totalBeats ? 100.0 * channels[i].beatsIn / totalBeats : 0.0);
+            fmt::print(
+                "{:>8} {:>7} {:>7.2f} {:>7} {:>10} {:>10} {:>9}\n", i, weightOf(i), scenario.load[i], scenario.dest[i], channels[i].beatsIn,
+                channels[i].beatsOut, share
+            );
+        }
+
+        fmt::print("Aggregate throughput: {:.4f} beats/cycle, Jain's fairness index (per weight): {:.4f}\n\n", throughput, fairness);
+
+        if (scenario.checkFairness) {
+            // A saturated pipeline accepts a beat every cycle, and no channel may be off its weighted share by more than one turn
+            if (throughput < 0.99) fail(scenario, fmt::format("aggregate throughput of {:.4f} beats/cycle", throughput));
+
+            for (u32 i = 0; i < MC_CHANNELS; i++) {
+                const f64 expected = f64(totalBeats) * weightOf(i) / totalWeight;
+                if (std::abs(f64(channels[i].beatsIn) - expected) > PACKET_LENGTH * maxWeight) {
+                    fail(scenario, fmt::format("channel {} got {} beats, expected about {:.0f}", i, channels[i].beatsIn, expected));
+                }
+            }
+        }
+
+        delete top;
+        delete ctx;
+    }
+}  // namespace
+
+void MultiChannel::runFairnessTest() {
+    const auto reference = polynomialResults();
+
+    std::array<u32, MC_CHANNELS> ownOutput, outputZero;
+    std::array<f64, MC_CHANNELS> saturated, bursty, alwaysReady, slowOutputOne;
+
+    for (u32 i = 0; i < MC_CHANNELS; i++) {
+        ownOutput[i] = i;
+        outputZero[i] = 0;
+        saturated[i] = 1.0;
+        bursty[i] = 1.0 / (1 << i);  // 100%, 50%, 25%, ... of the cycles
+        alwaysReady[i] = 1.0;
+        slowOutputOne[i] = (i == 1) ? 0.05 : 1.0;
+    }
+
+    const Scenario scenarios[] = {
+        {"Round robin, saturated", false, true, ownOutput, saturated, alwaysReady},
+        {"Weighted round robin, saturated", true, true, ownOutput, saturated, alwaysReady},
+        {"Round robin, all channels to output 0", false, true, outputZero, saturated, alwaysReady},
+        {"Round robin, bursty inputs", false, false, ownOutput, bursty, alwaysReady},
+        {"Round robin, output 1 only ready 5% of the time", false, false, ownOutput, saturated, slowOutputOne},
+    };
+
+    fmt::print("{} channels, {}-beat packets, {} cycles per scenario\n\n", MC_CHANNELS, PACKET_LENGTH, TEST_CYCLES);
+
+    for (const auto& scenario : scenarios) {
+        if (scenario.weighted) {
+            runScenario<SigmoidMultiChannelWeighted>(scenario, reference);
+        } else {
+            runScenario<SigmoidMultiChannel>(scenario, reference);
+        }
+    }
+}
@@ -0,0 +1,175 @@
+#include "output_format.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "bf16.hpp"
+#include "helpers.hpp"
+#include "sigmoid.hpp"
+
+namespace {
+    constexpr u32 TOTAL_INPUTS = 1 << 16;
+    constexpr u32 PACKET_LENGTH = 1021;  // Not a multiple of any lane count, so most packets end on a partially filled beat
+
+    struct RunStats {
+        u64 cycles = 0;  // Until the last result came out
+        u64 beats = 0;
+        f64 maxAbsError = 0.0;  // Against the exact sigmoid, over inputs that aren't NaN
+    };
+
+    // Verilator ports up to 64 bits wide are plain integers, wider ones are VlWide arrays of 32-bit words
+    template <typename Port>
+    std::vector<u32> portWords(const Port& port) {
+        if constexpr (std::is_integral_v<Port>) {
+            return {u32(port), u32(u64(port) >> 32)};
+        } else {
+            return std::vector<u32>(port.data(), port.data() + sizeof(Port) / sizeof(u32));
+        }
+    }
+
+    std::string toHex(const std::vector<u32>& words) {
+        std::string hex;
+        for (auto word = words.rbegin(); word != words.rend(); word++) hex += fmt::format("{:08X}", *word);
+        return hex;
+    }
+
+    [[noreturn]] void fail(const OutputFormat::Info& info, const std::string& message) {
+        fmt::print("{}: {}\n", info.name, message);
+        std::abort();
+    }
+
+    // Send every input in order, in packets of PACKET_LENGTH, with the output ready on a `readiness` fraction of the cycles
+    template <typename Top>
+    RunStats runFormat(const OutputFormat::Info& info, const std::vector<u16>& reference, u32 beatWidth, f64 readiness) {
+        auto ctx = new VerilatedContext();
+        auto top = new Top(ctx, "TOP");
+
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<f64> chance(0.0, 1.0);
+        const u32 lanes = beatWidth / info.width;
+
+        const auto step = [&top]() {
+            top->aclk = 0;
+            top->eval();
+            top->aclk = 1;
+            top->eval();
+        };
+
+        top->aresetn = 0;
+        top->s_axis_tvalid = 0;
+        top->m_axis_tready = 0;
+        for (int i = 0; i < 10; i++) step();
+        top->aresetn = 1;
+
+        RunStats stats;
+        std::vector<u16> results;
+        results.reserve(TOTAL_INPUTS);
+        u32 nextInput = 0;
+
+        while (results.size() < TOTAL_INPUTS) {
+            if (stats.cycles++ > TOTAL_INPUTS * 16) fail(info, fmt::format("stalled after {} results", results.size()));
+
+            top->s_axis_tvalid = nextInput < TOTAL_INPUTS;
+            top->s_axis_tdata = u16(nextInput);
+            top->s_axis_tlast = (nextInput % PACKET_LENGTH == PACKET_LENGTH - 1) || nextInput == TOTAL_INPUTS - 1;
+            top->m_axis_tready = chance(rng) < readiness;
+
+            // Settle combinational logic, then sample handshakes as they'll be seen by the rising edge
+            top->aclk = 0;
+            top->eval();
+
+            if (top->s_axis_tvalid && top->s_axis_tready) nextInput++;
+
+            if (top->m_axis_tvalid && top->m_axis_tready) {
+                const usize first = results.size();
+                const auto keep = portWords(top->m_axis_tkeep);
+                OutputFormat::unpackBeat(info.format, portWords(top->m_axis_tdata), keep, beatWidth, results);
+                stats.beats++;
+
+                if (results.size() == first || results.size() > TOTAL_INPUTS) {
+                    fail(info, fmt::format("beat {} holds {} results (tkeep {})", stats.beats, results.size() - first, toHex(keep)));
+                }
+
+                // A beat never spans 2 packets, is full unless it ends a packet, and has tlast set exactly when it does
+                const usize last = results.size() - 1;
+                const bool endsPacket = (last % PACKET_LENGTH == PACKET_LENGTH - 1) || last == TOTAL_INPUTS - 1;
+                const bool full = results.size() - first == lanes;
+
+                if (first / PACKET_LENGTH != last / PACKET_LENGTH || bool(top->m_axis_tlast) != endsPacket || (!full && !endsPacket)) {
+                    fail(
+                        info, fmt::format(
+                                  "beat with results {} to {} has tlast {}, tkeep {}, packets are {} results long", first, last,
+                                  top->m_axis_tlast, toHex(keep), PACKET_LENGTH
+                              )
+                    );
+                }
+            }
+
+            top->aclk = 1;
+            top->eval();
+        }
+
+        for (u32 input = 0; input < TOTAL_INPUTS; input++) {
+            const u16 expected = OutputFormat::fromBf16(info.format, reference[input]);
+
+            if (results[input] != expected) {
+                fail(
+                    info, fmt::format(
+                              "input {:04X} gave {:0{}X}, expected {:0{}X} (bf16 result {:04X})", input, results[input], info.width / 4, expected,
+                              info.width / 4, reference[input]
+                          )
+                );
+            }
+
+            if (!bf16::isNAN(u16(input))) {
+                const f64 exact = 1.0 / (1.0 + std::exp(-f64(bf16::toFloat(u16(input)))));
+                stats.maxAbsError = std::max(stats.maxAbsError, std::abs(OutputFormat::toDouble(info.format, results[input]) - exact));
+            }
+        }
+
+        delete top;
+        delete ctx;
+        return stats;
+    }
+
+    template <typename Top>
+    void testFormat(const OutputFormat::Info& info, const std::vector<u16>& reference, u32 beatWidth) {
+        // Always ready gives the output bandwidth, half ready shows whether the packing hides a slow DMA from the input side
+        const auto saturated = runFormat<Top>(info, reference, beatWidth, 1.0);
+        const auto halfReady = runFormat<Top>(info, reference, beatWidth, 0.5);
+
+        const f64 bytesPerResult = f64(saturated.beats) * (beatWidth / 8) / TOTAL_INPUTS;
+        fmt::print(
+            "{:>9} {:>10} {:>13.3f} {:>13.3f} {:>20.3f} {:>14.3e}\n", info.name, beatWidth, f64(TOTAL_INPUTS) / saturated.beats, bytesPerResult,
+            f64(TOTAL_INPUTS) / halfReady.cycles, saturated.maxAbsError
+        );
+    }
+}  // namespace
+
+void OutputFormat::runPackingTest() {
+    const auto reference = polynomialResults();
+
+    fmt::print("{}-result packets, all {} inputs\n\n", PACKET_LENGTH, TOTAL_INPUTS);
+    fmt::print(
+        "{:>9} {:>10} {:>13} {:>13} {:>20} {:>14}\n", "Format", "Beat bits", "Results/beat", "Bytes/result", "Results/cycle (50%)", "Max abs error"
+    );
+
+    for (const auto& info : formats) {
+        if (info.format == SIGMOID_FORMAT_UQ0_8) testFormat<SigmoidAxisUQ8>(info, reference, AXIS_BEAT_WIDTH);
+        if (info.format == SIGMOID_FORMAT_UQ0_16) testFormat<SigmoidAxisUQ16>(info, reference, AXIS_BEAT_WIDTH);
+        if (info.format == SIGMOID_FORMAT_FP8_E4M3) testFormat<SigmoidAxisE4M3>(info, reference, AXIS_BEAT_WIDTH);
+        if (info.format == SIGMOID_FORMAT_FP8_E5M2) testFormat<SigmoidAxisE5M2>(info, reference, AXIS_BEAT_WIDTH);
+    }
+
+    // Wide beats, where tdata and tkeep span several 32-bit words. formats is indexed by format code
+    testFormat<SigmoidAxisUQ8Wide>(formats[SIGMOID_FORMAT_UQ0_8], reference, AXIS_WIDE_BEAT_WIDTH);
+
+    fmt::print("\nbf16 results take 2 bytes each, one per 16-bit beat with the default axis_sigmoid parameters\n");
+}
@@ -1,29 +1,28 @@
 #include <SDL.h>
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <cli_args/cli_args.hpp>
+#include <cmath>
 #include <fstream>
+#include <iterator>
+#include <string_view>
+#include <vector>
 
+#include "benchmark.hpp"
+#include "bf16.hpp"
+#include "bf16_convert.hpp"
 #include "helpers.hpp"
 #include "imgui_impl_sdl2.h"
+#include "multichannel.hpp"
+#include "output_format.hpp"
 #include "sigmoid.hpp"
+#include "toggle_report.hpp"
 #include "ui.hpp"
 
 void parseCmdlineArgs(Sigmoid* top, int argc, char** argv);
 void printHelp();
 
-void stepCycles(Sigmoid* top, uint cycles) {
-    while (cycles > 0) {
-        top->clk = 0;
-        top->eval();
-
-        top->clk = 1;
-        top->eval();
-
-        cycles--;
-    }
-}
-
 int main(int argc, char** argv) {
     auto ctx = new VerilatedContext();
     auto top = new Sigmoid(ctx, "TOP");
@@ -67,50 +66,119 @@ void parseCmdlineArgs(Sigmoid* top, int argc, char** argv) {
 
     const bool help = args.get<bool>("h").value_or(false) || args.get<bool>("help").value_or(false);
     const bool headless = args.get<bool>("headless").value_or(false);
+    const bool compare = args.get<bool>("compare").value_or(false);
+    const bool multiChannel = args.get<bool>("multichannel").value_or(false);
+    const bool formats = args.get<bool>("formats").value_or(false);
+    const bool toggles = args.get<bool>("toggles").value_or(false);
 
     if (help) {
         printHelp();
         std::exit(0);
     }
 
+    if (compare) {
+        Benchmark::compareEngines();
+        std::exit(0);
+    }
+
+    if (multiChannel) {
+        MultiChannel::runFairnessTest();
+        std::exit(0);
+    }
+
+    if (formats) {
+        OutputFormat::runPackingTest();
+        std::exit(0);
+    }
+
+    if (toggles) {
+        ToggleReport::compareOperandIsolation();
+        std::exit(0);
+    }
+
     if (headless) {
         const std::string testCaseFilename = args.get<std::string>("input").value_or("");
-        int testsRan = 0, testsFailed = 0;
 
         if (testCaseFilename.empty()) {
             fmt::print("Headless mode specified but no test case file was provided\n");
             std::abort();
         }
 
-        std::ifstream inputFile(testCaseFilename);
+        std::ifstream inputFile(testCaseFilename, std::ios::binary);
         if (!inputFile.good() || !inputFile.is_open()) {
             fmt::print("Failed to open input file\n");
             std::abort();
         }
 
-        while (!inputFile.eof()) {
-            u16 input, expected;
-            inputFile >> std::hex >> input >> std::hex >> expected;
+        // Read the whole file up front and parse the test cases in place
+        const std::string contents{std::istreambuf_iterator<char>(inputFile), std::istreambuf_iterator<char>()};
+        std::string_view remaining = contents;
+        std::vector<u16> inputs, expected;
+
+        const auto nextToken = [&remaining]() {
+            constexpr std::string_view whitespace = " \t\r\n";
+            const auto start = std::min(remaining.find_first_not_of(whitespace), remaining.size());
+            remaining.remove_prefix(start);
+
+            const auto length = std::min(remaining.find_first_of(whitespace), remaining.size());
+            const auto token = remaining.substr(0, length);
+            remaining.remove_prefix(length);
+            return token;
+        };
+
+        while (true) {
+            const auto inputToken = nextToken();
+            const auto expectedToken = nextToken();
+            if (inputToken.empty()) break;
+
+            const auto parsedInput = bf16::fromHexString(inputToken);
+            const auto parsedExpected = bf16::fromHexString(expectedToken);
+
+            if (!parsedInput.has_value() || !parsedExpected.has_value()) {
+                fmt::print("Malformed test case: \"{} {}\"\n", inputToken, expectedToken);
+                std::abort();
+            }
+
+            inputs.push_back(*parsedInput);
+            expected.push_back(*parsedExpected);
+        }
 
-            top->data_in = input;
+        std::vector<u16> outputs(inputs.size());
+
+        for (usize i = 0; i < inputs.size(); i++) {
+            top->data_in = inputs[i];
             top->valid_in = 1;
             top->rst = 0;
-            testsRan++;
 
-            // Step until the result is at the end of the pipeline, then compare with expected output
+            // Step until the result is at the end of the pipeline
             stepCycles(top, PIPELINE_STAGES);
+            outputs[i] = top->data_out;
+        }
 
-            if (top->data_out != expected) {
-                testsFailed++;
-                fmt::print("Test case failed\n");
-                fmt::print("Input: {:04X}\n", input);
-                fmt::print("Output: {:04X}, expected: {:04X}\n", top->data_out, expected);
-            }
+        // Decode every value in one batch for the report
+        std::vector<float> inputFloats(inputs.size()), outputFloats(outputs.size()), expectedFloats(expected.size());
+        bf16::toFloats(inputs, inputFloats);
+        bf16::toFloats(outputs, outputFloats);
+        bf16::toFloats(expected, expectedFloats);
+
+        const usize testsRan = inputs.size();
+        usize testsFailed = 0;
+        f64 maxAbsError = 0.0;
+
+        for (usize i = 0; i < testsRan; i++) {
+            maxAbsError = std::max(maxAbsError, std::abs(f64(outputFloats[i]) - f64(expectedFloats[i])));
+            if (outputs[i] == expected[i]) continue;
+
+            testsFailed++;
+            fmt::print("Test case failed\n");
+            fmt::print("Input: {:04X} ({})\n", inputs[i], inputFloats[i]);
+            fmt::print("Output: {:04X} ({}), expected: {:04X} ({})\n", outputs[i], outputFloats[i], expected[i], expectedFloats[i]);
         }
 
-        fmt::print("Tests ran:    {}\n", testsRan);
-        fmt::print("Tests passed: {}\n", testsRan - testsFailed);
-        fmt::print("Tests failed: {}\n", testsFailed);
+        fmt::print("Tests ran:     {}\n", testsRan);
+        fmt::print("Tests passed:  {}\n", testsRan - testsFailed);
+        fmt::print("Tests failed:  {}\n", testsFailed);
+        fmt::print("Max abs error: {:.3e}\n", maxAbsError);
 
         // Exit with an error if we had failures
         std::exit(testsFailed != 0 ? -1 : 0);
@@ -122,7 +190,11 @@ void printHelp() {
         "Options:\n"
         "  -h, --help             Show this help message\n"
         "  --headless             Run tests in headless mode\n"
-        "  --input <filename>     Input file for headless testing\n\n"
+        "  --input <filename>     Input file for headless testing\n"
+        "  --compare              Compare latency, throughput and accuracy of the polynomial, LUT and deep pipelined sigmoid engines\n"
+        "  --multichannel         Test arbitration fairness and throughput of the multi-channel AXI-Stream wrapper\n"
+        "  --formats              Check the reduced precision output formats (UQ0.8, UQ0.16, FP8) and their packing into output beats\n"
+        "  --toggles              Compare toggle counts per pipeline stage with and without operand isolation, under idle, bursty and saturated traffic\n\n"
         "The input file for headless testing should contain test cases in the form:\n"
         "  <input_data> <expected_output>\n"
         "Where both values are bfloat16 hex values\n"
@@ -0,0 +1,210 @@
+#include "toggle_report.hpp"
+
+#include <fmt/format.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "helpers.hpp"
+#include "sigmoid.hpp"
+#include "verilated_cov.h"
+
+namespace {
+    constexpr u32 TEST_CYCLES = 10000;
+    constexpr u32 STAGES = PIPELINE_STAGES;  // From sigmoid_pkg.sv, through the generated sigmoid_params.hpp
+    static_assert(STAGES <= 10, "stageOf() reads the stage number of stageN_curr/stageN_next from a single digit");
+    constexpr u32 OTHER = STAGES;  // Bucket for signals outside of any stage, like the clock and reset
+
+    // Toggles an isolated stage past stage 0 may still see while idle, e.g. leaving reset
+    constexpr u64 IDLE_TOGGLE_SLACK = 8;
+
+    // valid_in is set for the first activeCycles of every period
+    struct Traffic {
+        const char* name;
+        u32 activeCycles;
+        u32 period;
+    };
+
+    struct RunResult {
+        std::array<u64, STAGES + 1> toggles{};
+        std::vector<u16> outputs;  // Every valid result, in order
+    };
+
+    // Signals and FPU instances of sigmoid_pipelined that don't follow the stageN_curr/stageN_next naming, by pipeline stage
+    const std::unordered_map<std::string_view, u32> STAGE_OF = {
+        {"valid_in", 0},       {"data_in", 0},   {"data_in_abs", 0}, {"is_negative", 0}, {"gen_less_than", 1},
+        {"less_than", 1},      {"a0", 1},        {"a1", 1},          {"a2", 1},          {"offset", 1},
+        {"add1", 1},           {"mul1", 2},      {"mul2", 2},        {"mul3", 3},        {"add2", 3},
+        {"add3", 4},           {"flip_poly", 5}, {"valid_out", 5},   {"data_out", 5},    {"one_minus_polynomial_output", 5},
+    };
+
+    // Signals directly in sigmoid_pipelined go by their own name, signals of submodules by the name of the instance under it
+    u32 stageOf(std::string_view hierarchy, std::string_view signal) {
+        constexpr std::string_view top = "sigmoid_pipelined";
+        const auto topPosition = hierarchy.find(top);
+        std::string_view name = signal;
+
+        if (topPosition != std::string_view::npos && topPosition + top.size() < hierarchy.size()) {
+            name = hierarchy.substr(topPosition + top.size() + 1);
+        }
+
+        // Strip struct members, bit indices, toggle directions and generate block indices
+        name = name.substr(0, std::min(name.find_first_of(".[:"), name.find("__BRA__")));
+
+        if (name.size() > 5 && name.starts_with("stage") && name[5] >= '0' && name[5] < char('0' + STAGES)) return name[5] - '0';
+
+        const auto stage = STAGE_OF.find(name);
+        return stage != STAGE_OF.end() ? stage->second : OTHER;
+    }
+
+    // Sum up the toggle counts of a coverage file written by Verilator, one point per line:
+    // C '<fields>' <count>, where fields are \001key\002value pairs. "page" is v_toggle/<module> for toggle points,
+    // "h" is the hierarchy of the module instance and "o" is the signal, including the bit
+    std::array<u64, STAGES + 1> readToggleCounts(const std::filesystem::path& path) {
+        std::array<u64, STAGES + 1> toggles{};
+        std::ifstream file(path);
+        std::string line;
+        u32 points = 0;
+
+        while (std::getline(file, line)) {
+            if (!line.starts_with("C '")) continue;
+
+            const auto fieldsEnd = line.rfind('\'');
+            std::string_view fields = std::string_view(line).substr(3, fieldsEnd - 3);
+            std::string_view page, hierarchy, signal;
+
+            while (!fields.empty()) {
+                const auto next = fields.find('\001', 1);
+                const auto field = fields.substr(1, next == std::string_view::npos ? std::string_view::npos : next - 1);
+                const auto separator = field.find('\002');
+                fields.remove_prefix(next == std::string_view::npos ? fields.size() : next);
+
+                if (separator == std::string_view::npos) continue;
+                const auto key = field.substr(0, separator), value = field.substr(separator + 1);
+
+                if (key == "page") page = value;
+                if (key == "h") hierarchy = value;
+                if (key == "o") signal = value;
+            }
+
+            if (!page.starts_with("v_toggle")) continue;
+
+            toggles[stageOf(hierarchy, signal)] += std::strtoull(line.c_str() + fieldsEnd + 1, nullptr, 10);
+            points++;
+        }
+
+        if (points == 0) {
+            fmt::print("No toggle coverage points in {}, was the model verilated with --coverage-toggle?\n", path.string());
+            std::abort();
+        }
+
+        return toggles;
+    }
+
+    template <typename Top>
+    RunResult run(const Traffic& traffic) {
+        auto ctx = new VerilatedContext();
+        auto top = new Top(ctx, "TOP");
+        // One coverage file per process and run, so parallel or repeated runs never read each other's counts
+        static u32 runIndex = 0;
+        const auto coveragePath =
+            std::filesystem::temp_directory_path() / fmt::format("sigmoid_toggle_coverage_{}_{}.dat", getpid(), runIndex++);
+
+        // The data bus keeps changing whether valid_in is set or not, as AXI-Stream allows
+        std::mt19937 rng(1234);
+        std::uniform_int_distribution<u32> randomData(0, 0xFFFF);
+        RunResult result;
+
+        top->rst = 1;
+        top->valid_in = 0;
+        stepCycles(top, 10);
+        top->rst = 0;
+
+        // Only count toggles from after reset
+        ctx->coveragep()->zero();
+
+        for (u32 cycle = 0; cycle < TEST_CYCLES; cycle++) {
+            top->valid_in = (cycle % traffic.period) < traffic.activeCycles;
+            top->data_in = u16(randomData(rng));
+            stepCycles(top, 1);
+
+            if (top->valid_out) result.outputs.push_back(top->data_out);
+        }
+
+        // Keep separate counts for every FPU instance instead of merging them per module
+        ctx->coveragep()->forcePerInstance(true);
+        ctx->coveragep()->write(coveragePath.string());
+        result.toggles = readToggleCounts(coveragePath);
+        std::filesystem::remove(coveragePath);
+
+        delete top;
+        delete ctx;
+        return result;
+    }
+}  // namespace
+
+void ToggleReport::compareOperandIsolation() {
+    const Traffic patterns[] = {
+        {"Idle (valid_in never set)", 0, 1},
+        {"Bursty (64 valid cycles out of every 256)", 64, 256},
+        {"Saturated (valid_in always set)", 1, 1},
+    };
+
+    fmt::print("Toggle counts of sigmoid_pipelined per pipeline stage, {} cycles per traffic pattern\n", TEST_CYCLES);
+    fmt::print("data_in changes every cycle, including the ones where valid_in is low\n\n");
+
+    for (const auto& traffic : patterns) {
+        const auto plain = run<SigmoidToggle>(traffic);
+        const auto isolated = run<SigmoidToggleIsolated>(traffic);
+
+        // Isolation must never change the results, only what happens in between them
+        if (plain.outputs != isolated.outputs) {
+            fmt::print("{}: results differ with operand isolation\n", traffic.name);
+            std::abort();
+        }
+
+        fmt::print("{}\n", traffic.name);
+        fmt::print("{:>8} {:>12} {:>12} {:>8}\n", "Stage", "Plain", "Isolated", "Saved");
+
+        u64 plainTotal = 0, isolatedTotal = 0;
+        const auto printRow = [](const std::string& stage, u64 plainToggles, u64 isolatedToggles) {
+            const f64 saved = plainToggles ? 100.0 * (1.0 - f64(isolatedToggles) / plainToggles) : 0.0;
+            fmt::print("{:>8} {:>12} {:>12} {:>7.1f}%\n", stage, plainToggles, isolatedToggles, saved);
+        };
+
+        for (u32 stage = 0; stage <= STAGES; stage++) {
+            printRow(stage == OTHER ? "Other" : std::to_string(stage), plain.toggles[stage], isolated.toggles[stage]);
+            plainTotal += plain.toggles[stage];
+            isolatedTotal += isolated.toggles[stage];
+        }
+
+        printRow("Total", plainTotal, isolatedTotal);
+        fmt::print("\n");
+
+        // Every bubble is a cycle where isolation holds the operands still, only fully saturated traffic may come out even
+        const bool saturated = traffic.activeCycles >= traffic.period;
+        if (saturated ? isolatedTotal > plainTotal : isolatedTotal >= plainTotal) {
+            fmt::print("{}: operand isolation went from {} to {} toggles\n", traffic.name, plainTotal, isolatedTotal);
+            std::abort();
+        }
+
+        // With no valid input at all, only stage 0 sees data_in change, every later stage has to hold still
+        if (traffic.activeCycles == 0) {
+            for (u32 stage = 1; stage < STAGES; stage++) {
+                if (isolated.toggles[stage] > IDLE_TOGGLE_SLACK) {
+                    fmt::print("{}: stage {} toggled {} times with operand isolation\n", traffic.name, stage, isolated.toggles[stage]);
+                    std::abort();
+                }
+            }
+        }
+    }
+}
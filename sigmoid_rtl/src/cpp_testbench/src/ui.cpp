@@ -16,6 +16,15 @@
 #define GET_FIELD(stage, field) stage.__PVT__##field
 #define CHECKBOX(label, value) ImGui::Checkbox(label, (bool*)&value)
 
+namespace {
+    // Show a bf16 value as "HEX (float)" in a text field. Formats into a stack buffer, so drawing doesn't allocate every frame
+    void drawBf16(const char* label, u16 value) {
+        bf16::FormatBuffer buffer;
+        bf16::format(value, buffer);
+        ImGui::InputText(label, buffer.data(), buffer.size());
+    }
+}  // namespace
+
 // Draw top-level module inputs (rst, data_in, valid_in) and outputs (data_out, valid_out)
 void UI::drawTopModule(Sigmoid* top) {
     ImGui::SetNextWindowSize(ImVec2(280, 200), ImGuiCond_FirstUseEver);
@@ -23,7 +32,6 @@ void UI::drawTopModule(Sigmoid* top) {
     ImGui::Begin("Top Module");
 
     static char dataInStr[128] = "-0.5";
-    std::string dataOutStr = fmt::format("{:04X} ({:0.4f})", top->data_out, bf16::toFloat(top->data_out));
 
     ImGui::InputText("data_in", dataInStr, IM_COUNTOF(dataInStr));
     auto dataIn = bf16::fromString(dataInStr);
@@ -34,7 +42,7 @@ void UI::drawTopModule(Sigmoid* top) {
 
     // data_out shouldn't be toggleable by the user
     ImGui::PushItemFlag(ImGuiItemFlags_Disabled, true);
-    ImGui::InputText("data_out", (char*)dataOutStr.c_str(), dataOutStr.size());
+    drawBf16("data_out", top->data_out);
     ImGui::PopItemFlag();
 
     CHECKBOX("rst", top->rst);
@@ -87,11 +95,10 @@ void UI::drawStage0(Sigmoid* top) {
     const auto& valid = GET_FIELD(stage, valid);
     const auto& is_negative = GET_FIELD(stage, is_negative);
     const auto& x_abs = GET_FIELD(stage, x_abs);
-    std::string x_abs_str = fmt::format("{:04X} ({:0.4f})", x_abs, bf16::toFloat(x_abs));
 
     CHECKBOX("valid##0", valid);
     CHECKBOX("is_negative##0", is_negative);
-    ImGui::InputText("x_abs", (char*)x_abs_str.c_str(), x_abs_str.size());
+    drawBf16("x_abs", x_abs);
 }
 
 void UI::drawStage1(Sigmoid* top) {
@@ -106,18 +113,13 @@ void UI::drawStage1(Sigmoid* top) {
     const auto& a1 = GET_FIELD(stage, a1);
     const auto& a2 = GET_FIELD(stage, a2);
 
-    std::string x_offset_str = fmt::format("{:04X} ({:0.4f})", x_offset, bf16::toFloat(x_offset));
-    std::string a0_str = fmt::format("{:04X} ({:0.4f})", a0, bf16::toFloat(a0));
-    std::string a1_str = fmt::format("{:04X} ({:0.4f})", a1, bf16::toFloat(a1));
-    std::string a2_str = fmt::format("{:04X} ({:0.4f})", a2, bf16::toFloat(a2));
-
     CHECKBOX("valid##1", valid);
     CHECKBOX("is_negative##1", is_negative);
 
-    ImGui::InputText("x_offset##1", (char*)x_offset_str.c_str(), x_offset_str.size());
-    ImGui::InputText("a0##1", (char*)a0_str.c_str(), a0_str.size());
-    ImGui::InputText("a1##1", (char*)a1_str.c_str(), a1_str.size());
-    ImGui::InputText("a2##1", (char*)a2_str.c_str(), a2_str.size());
+    drawBf16("x_offset##1", x_offset);
+    drawBf16("a0##1", a0);
+    drawBf16("a1##1", a1);
+    drawBf16("a2##1", a2);
 }
 
 void UI::drawStage2(Sigmoid* top) {
@@ -132,18 +134,13 @@ void UI::drawStage2(Sigmoid* top) {
     const auto& mul_a1_x = GET_FIELD(stage, mul_a1_x);
     const auto& a2 = GET_FIELD(stage, a2);
 
-    std::string x_squared_str = fmt::format("{:04X} ({:0.4f})", x_squared, bf16::toFloat(x_squared));
-    std::string a0_str = fmt::format("{:04X} ({:0.4f})", a0, bf16::toFloat(a0));
-    std::string mul_a1_x_str = fmt::format("{:04X} ({:0.4f})", mul_a1_x, bf16::toFloat(mul_a1_x));
-    std::string a2_str = fmt::format("{:04X} ({:0.4f})", a2, bf16::toFloat(a2));
-
     CHECKBOX("valid##2", valid);
     CHECKBOX("is_negative##2", is_negative);
 
-    ImGui::InputText("x_squared##2", (char*)x_squared_str.c_str(), x_squared_str.size());
-    ImGui::InputText("mul_a1_x##2", (char*)mul_a1_x_str.c_str(), mul_a1_x_str.size());
-    ImGui::InputText("a0##2", (char*)a0_str.c_str(), a0_str.size());
-    ImGui::InputText("a2##2", (char*)a2_str.c_str(), a2_str.size());
+    drawBf16("x_squared##2", x_squared);
+    drawBf16("mul_a1_x##2", mul_a1_x);
+    drawBf16("a0##2", a0);
+    drawBf16("a2##2", a2);
 }
 
 void UI::drawStage3(Sigmoid* top) {
@@ -156,14 +153,11 @@ void UI::drawStage3(Sigmoid* top) {
     const auto& mul_a2_x2 = GET_FIELD(stage, mul_a2_x2);
     const auto& add_a0_a1 = GET_FIELD(stage, add_a0_a1);
 
-    std::string mul_a2_x2_str = fmt::format("{:04X} ({:0.4f})", mul_a2_x2, bf16::toFloat(mul_a2_x2));
-    std::string add_a0_a1_str = fmt::format("{:04X} ({:0.4f})", add_a0_a1, bf16::toFloat(add_a0_a1));
-
     CHECKBOX("valid##3", valid);
     CHECKBOX("is_negative##3", is_negative);
 
-    ImGui::InputText("mul_a2_x2##3", (char*)mul_a2_x2_str.c_str(), mul_a2_x2_str.size());
-    ImGui::InputText("add_a0_a1##3", (char*)add_a0_a1_str.c_str(), add_a0_a1_str.size());
+    drawBf16("mul_a2_x2##3", mul_a2_x2);
+    drawBf16("add_a0_a1##3", add_a0_a1);
 }
 
 void UI::drawStage4(Sigmoid* top) {
@@ -174,12 +168,10 @@ void UI::drawStage4(Sigmoid* top) {
     const auto& is_negative = GET_FIELD(stage, is_negative);
     const auto& poly_result = GET_FIELD(stage, poly_result);
 
-    std::string poly_result_str = fmt::format("{:04X} ({:0.4f})", poly_result, bf16::toFloat(poly_result));
-
     CHECKBOX("valid##4", valid);
     CHECKBOX("is_negative##4", is_negative);
 
-    ImGui::InputText("poly_result##4", (char*)poly_result_str.c_str(), poly_result_str.size());
+    drawBf16("poly_result##4", poly_result);
 }
 
 void UI::drawStage5(Sigmoid* top) {
@@ -189,10 +181,8 @@ void UI::drawStage5(Sigmoid* top) {
     const auto& valid = GET_FIELD(stage, valid);
     const auto& result = GET_FIELD(stage, result);
 
-    std::string result_str = fmt::format("{:04X} ({:0.4f})", result, bf16::toFloat(result));
-
     CHECKBOX("valid##5", valid);
-    ImGui::InputText("result##5", (char*)result_str.c_str(), result_str.size());
+    drawBf16("result##5", result);
 }
 
 std::pair<SDL_Window*, SDL_GLContext> UI::init() {
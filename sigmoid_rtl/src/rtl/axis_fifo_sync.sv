@@ -0,0 +1,93 @@
+`default_nettype none
+`timescale 1ns / 1ps
+
+// Synchronous first-word-fall-through FIFO with a programmable full flag, for the AXI-Stream wrappers
+// Synthesis uses xpm_fifo_sync (configured like the one in axis_sigmoid). Verilator doesn't ship the XPM library,
+// so it gets an equivalent behavioural model instead, which lets us simulate whole wrappers in the C++ testbench
+// prog_full is set while the FIFO holds PROG_FULL_THRESH or more words
+module axis_fifo_sync #(
+    parameter int WIDTH = 17,
+    parameter int DEPTH = 32,
+    parameter int PROG_FULL_THRESH = 26
+) (
+    input  wire              clk,
+    input  wire              rst,
+    // Write Interface
+    input  wire              wr_en,
+    input  wire  [WIDTH-1:0] din,
+    output wire              prog_full,
+    // Read Interface
+    input  wire              rd_en,
+    output wire  [WIDTH-1:0] dout,
+    output wire              empty
+);
+
+`ifdef VERILATOR
+  logic [WIDTH-1:0] memory[DEPTH];
+  logic [$clog2(DEPTH)-1:0] rd_ptr, wr_ptr;
+  logic [$clog2(DEPTH+1)-1:0] count;
+
+  wire do_write = wr_en && (count != DEPTH);
+  wire do_read = rd_en && (count != 0);
+
+  always_ff @(posedge clk) begin
+    if (rst) begin
+      rd_ptr <= '0;
+      wr_ptr <= '0;
+      count  <= '0;
+    end else begin
+      if (do_write) begin
+        memory[wr_ptr] <= din;
+        wr_ptr <= (wr_ptr == DEPTH - 1) ? '0 : wr_ptr + 1'b1;
+      end
+
+      if (do_read) begin
+        rd_ptr <= (rd_ptr == DEPTH - 1) ? '0 : rd_ptr + 1'b1;
+      end
+
+      count <= count + do_write - do_read;
+    end
+  end
+
+  assign dout      = memory[rd_ptr];
+  assign empty     = (count == 0);
+  assign prog_full = (count >= PROG_FULL_THRESH);
+
+`else
+  xpm_fifo_sync #(
+      .FIFO_MEMORY_TYPE("auto"),
+      .FIFO_WRITE_DEPTH(DEPTH),
+      .WRITE_DATA_WIDTH(WIDTH),
+      .READ_DATA_WIDTH(WIDTH),
+      .READ_MODE("fwft"),
+      .PROG_FULL_THRESH(PROG_FULL_THRESH),
+      .USE_ADV_FEATURES("0200")  // Enable prog_full (Bit 1)
+  ) xpm_fifo_inst (
+      .wr_clk   (clk),
+      .rst      (rst),
+      // -- Write Interface --
+      .wr_en    (wr_en),
+      .din      (din),
+      .full     (),
+      .prog_full(prog_full),
+      // -- Read Interface --
+      .rd_en    (rd_en),
+      .dout     (dout),
+      .empty    (empty),
+
+      // Unused
+      .overflow     (),
+      .wr_rst_busy  (),
+      .rd_rst_busy  (),
+      .prog_empty   (),
+      .underflow    (),
+      .data_valid   (),
+      .sleep        (1'b0),
+      .injectsbiterr(1'b0),
+      .injectdbiterr(1'b0),
+      .sbiterr      (),
+      .dbiterr      ()
+  );
+`endif
+
+endmodule
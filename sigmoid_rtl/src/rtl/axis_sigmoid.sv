@@ -1,28 +1,44 @@
 `default_nettype none
 `timescale 1ns / 1ps
 
-module axis_sigmoid (
-    input  wire        aclk,
-    input  wire        aresetn,
+import sigmoid_pkg::*;
+
+// ENGINE selects the sigmoid implementation, see sigmoid_engine.sv ("POLYNOMIAL", "LUT" or "DEEP")
+// DEEP_FPU_STAGES sets the cycles per FPU operation of the "DEEP" engine, ignored by the others
+// OPERAND_ISOLATION stops the "POLYNOMIAL" engine from toggling on bubbles, see sigmoid_pipelined.sv
+// OUTPUT_FORMAT selects the format of the results (SIGMOID_FORMAT_* in sigmoid_pkg.sv), M_AXIS_WIDTH / format width of them
+// are packed into every output beat, see sigmoid_output_packer.sv. The defaults keep one bf16 result per 16-bit beat
+module axis_sigmoid #(
+    parameter ENGINE = "POLYNOMIAL",
+    parameter int DEEP_FPU_STAGES = SIGMOID_DEEP_FPU_STAGES,
+    parameter bit OPERAND_ISOLATION = 0,
+    parameter int OUTPUT_FORMAT = SIGMOID_FORMAT_BF16,
+    parameter int M_AXIS_WIDTH = 16
+) (
+    input  wire                      aclk,
+    input  wire                      aresetn,
     // S_AXIS
-    input  wire [15:0] s_axis_tdata,
-    input  wire        s_axis_tlast,
-    input  wire        s_axis_tvalid,
-    output wire        s_axis_tready,
+    input  wire [              15:0] s_axis_tdata,
+    input  wire                      s_axis_tlast,
+    input  wire                      s_axis_tvalid,
+    output wire                      s_axis_tready,
     // M_AXIS
-    output wire [15:0] m_axis_tdata,
-    output wire        m_axis_tlast,
-    output wire        m_axis_tvalid,
-    input  wire        m_axis_tready
+    output wire [  M_AXIS_WIDTH-1:0] m_axis_tdata,
+    output wire [M_AXIS_WIDTH/8-1:0] m_axis_tkeep,
+    output wire                      m_axis_tlast,
+    output wire                      m_axis_tvalid,
+    input  wire                      m_axis_tready
 );
 
   // -------------------------------------------------------------------------
   // Parameters
   // -------------------------------------------------------------------------
-  localparam integer PIPELINE_LATENCY = 6;
+  localparam integer PIPELINE_LATENCY = (ENGINE == "LUT") ? SIGMOID_LUT_LATENCY :
+                                        (ENGINE == "DEEP") ? sigmoid_deep_latency(DEEP_FPU_STAGES) : SIGMOID_POLY_LATENCY;
+  localparam integer OUTPUT_LATENCY = sigmoid_output_latency(OUTPUT_FORMAT, M_AXIS_WIDTH);
   localparam integer FIFO_DEPTH = 32;
-  localparam integer PROG_FULL_THRESH = FIFO_DEPTH - PIPELINE_LATENCY;
-  localparam integer FIFO_WIDTH = 16 + 1;  // 16 bits Data + 1 bit TLast
+  localparam integer PROG_FULL_THRESH = FIFO_DEPTH - PIPELINE_LATENCY - OUTPUT_LATENCY;
+  localparam integer FIFO_WIDTH = M_AXIS_WIDTH + M_AXIS_WIDTH / 8 + 1;  // Data + TKeep + 1 bit TLast
 
 
   logic [          15:0] core_data_out;
@@ -31,6 +47,12 @@ module axis_sigmoid (
   wire                   fifo_prog_full;
   wire                   input_accepted;
 
+  // Packer outputs
+  wire                      packed_valid;
+  wire                      packed_last;
+  wire [  M_AXIS_WIDTH-1:0] packed_data;
+  wire [M_AXIS_WIDTH/8-1:0] packed_keep;
+
   // FIFO Signals
   wire                   fifo_empty;
   wire                   fifo_rd_en;
@@ -47,8 +69,7 @@ module axis_sigmoid (
   always_ff @(posedge aclk) begin
     if (!aresetn) begin
       tlast_pipe <= '0;
-    end
-    begin
+    end else begin
       tlast_pipe <= {tlast_pipe[PIPELINE_LATENCY-2:0], s_axis_tlast};
     end
   end
@@ -56,7 +77,11 @@ module axis_sigmoid (
   wire delayed_tlast = tlast_pipe[PIPELINE_LATENCY-1];
 
 
-  sigmoid_pipelined inst_sigmoid (
+  sigmoid_engine #(
+      .ENGINE(ENGINE),
+      .DEEP_FPU_STAGES(DEEP_FPU_STAGES),
+      .OPERAND_ISOLATION(OPERAND_ISOLATION)
+  ) inst_sigmoid (
       .clk     (aclk),
       .rst     (~aresetn),
       .valid_in(input_accepted),
@@ -67,49 +92,50 @@ module axis_sigmoid (
   );
 
 
-  // Pack Data and Tlast together: [TLAST | DATA]
-  assign fifo_din = {delayed_tlast, core_data_out};
-
-  xpm_fifo_sync #(
-      .FIFO_MEMORY_TYPE("auto"),
-      .FIFO_WRITE_DEPTH(FIFO_DEPTH),
-      .WRITE_DATA_WIDTH(FIFO_WIDTH),
-      .READ_DATA_WIDTH(FIFO_WIDTH),
-      .READ_MODE("fwft"),
-      .PROG_FULL_THRESH(PROG_FULL_THRESH),
-      .USE_ADV_FEATURES("0200")  // Enable prog_full (Bit 1)
-  ) xpm_fifo_inst (
-      .wr_clk   (aclk),
-      .rst      (~aresetn),        // XPM Sync FIFO reset is Active High
+  // Convert results to the output format and pack them into beats
+  sigmoid_output_packer #(
+      .FORMAT(OUTPUT_FORMAT),
+      .BEAT_WIDTH(M_AXIS_WIDTH)
+  ) inst_packer (
+      .clk     (aclk),
+      .rst     (~aresetn),
+      .valid_in(core_valid_out),
+      .last_in (delayed_tlast),
+      .data_in (core_data_out),
+
+      .valid_out(packed_valid),
+      .last_out (packed_last),
+      .data_out (packed_data),
+      .keep_out (packed_keep)
+  );
+
+
+  // Pack Data, TKeep and Tlast together: [TLAST | TKEEP | DATA]
+  assign fifo_din = {packed_last, packed_keep, packed_data};
+
+  axis_fifo_sync #(
+      .WIDTH(FIFO_WIDTH),
+      .DEPTH(FIFO_DEPTH),
+      .PROG_FULL_THRESH(PROG_FULL_THRESH)
+  ) inst_fifo (
+      .clk      (aclk),
+      .rst      (~aresetn),        // FIFO reset is Active High
       // -- Write Interface --
-      .wr_en    (core_valid_out),
+      .wr_en    (packed_valid),
       .din      (fifo_din),
-      .full     (),
       .prog_full(fifo_prog_full),
       // -- Read Interface --
       .rd_en    (fifo_rd_en),
       .dout     (fifo_dout),
-      .empty    (fifo_empty),
-
-      // Unused
-      .overflow     (),
-      .wr_rst_busy  (),
-      .rd_rst_busy  (),
-      .prog_empty   (),
-      .underflow    (),
-      .data_valid   (),
-      .sleep        (1'b0),
-      .injectsbiterr(1'b0),
-      .injectdbiterr(1'b0),
-      .sbiterr      (),
-      .dbiterr      ()
+      .empty    (fifo_empty)
   );
 
 
   // Data un-packing
   assign m_axis_tvalid = ~fifo_empty;
   assign fifo_rd_en    = m_axis_tvalid && m_axis_tready;
-  assign m_axis_tlast  = fifo_dout[16];  // MSB
-  assign m_axis_tdata  = fifo_dout[15:0];  // Lower 16 bits
+  assign m_axis_tlast  = fifo_dout[FIFO_WIDTH-1];  // MSB
+  assign m_axis_tkeep  = fifo_dout[M_AXIS_WIDTH+:M_AXIS_WIDTH/8];
+  assign m_axis_tdata  = fifo_dout[M_AXIS_WIDTH-1:0];  // Lower bits
 
 endmodule
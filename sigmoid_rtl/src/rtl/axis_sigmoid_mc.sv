@@ -0,0 +1,212 @@
+`default_nettype none
+`timescale 1ns / 1ps
+
+import sigmoid_pkg::*;
+
+// Multi-channel version of axis_sigmoid: NUM_CHANNELS input streams share a single sigmoid pipeline
+// Arbitration happens at packet granularity (a granted channel keeps the pipeline until its tlast beat), so packets are never
+// interleaved. Channels take turns in round-robin order, each sending up to WEIGHTS[i] back-to-back packets per turn
+// WEIGHTS of 1 for every channel (the default) give plain round robin. Idle channels and channels whose output FIFO is full are
+// skipped, so the pipeline stays fully used as long as any channel has data for an output with room in it. A channel that stalls
+// mid-packet (tvalid low, or its output filling up) still holds the pipeline until its tlast beat, like any packet-level arbiter
+// Results are routed to output tdest of the beat that produced them, with tid set to the input channel it came from
+// The channel IDs travel through a sideband pipeline next to tlast_pipe, every output gets its own FIFO
+// ENGINE/DEEP_FPU_STAGES/OPERAND_ISOLATION configure the sigmoid implementation, see axis_sigmoid.sv
+module axis_sigmoid_mc #(
+    parameter int NUM_CHANNELS = 4,
+    parameter bit [NUM_CHANNELS-1:0][7:0] WEIGHTS = {NUM_CHANNELS{8'd1}},
+    parameter ENGINE = "POLYNOMIAL",
+    parameter int DEEP_FPU_STAGES = SIGMOID_DEEP_FPU_STAGES,
+    parameter bit OPERAND_ISOLATION = 0,
+    localparam int CHANNEL_WIDTH = (NUM_CHANNELS > 1) ? $clog2(NUM_CHANNELS) : 1
+) (
+    input  wire                                        aclk,
+    input  wire                                        aresetn,
+    // S_AXIS, one per channel
+    input  wire  [NUM_CHANNELS-1:0][             15:0] s_axis_tdata,
+    input  wire  [NUM_CHANNELS-1:0][CHANNEL_WIDTH-1:0] s_axis_tdest,
+    input  wire  [NUM_CHANNELS-1:0]                    s_axis_tlast,
+    input  wire  [NUM_CHANNELS-1:0]                    s_axis_tvalid,
+    output logic [NUM_CHANNELS-1:0]                    s_axis_tready,
+    // M_AXIS, one per channel
+    output wire  [NUM_CHANNELS-1:0][             15:0] m_axis_tdata,
+    output wire  [NUM_CHANNELS-1:0][CHANNEL_WIDTH-1:0] m_axis_tid,
+    output wire  [NUM_CHANNELS-1:0][CHANNEL_WIDTH-1:0] m_axis_tdest,
+    output wire  [NUM_CHANNELS-1:0]                    m_axis_tlast,
+    output wire  [NUM_CHANNELS-1:0]                    m_axis_tvalid,
+    input  wire  [NUM_CHANNELS-1:0]                    m_axis_tready
+);
+
+  // -------------------------------------------------------------------------
+  // Parameters
+  // -------------------------------------------------------------------------
+  localparam integer PIPELINE_LATENCY = (ENGINE == "LUT") ? SIGMOID_LUT_LATENCY :
+                                        (ENGINE == "DEEP") ? sigmoid_deep_latency(DEEP_FPU_STAGES) : SIGMOID_POLY_LATENCY;
+  localparam integer FIFO_DEPTH = 32;
+  localparam integer PROG_FULL_THRESH = FIFO_DEPTH - PIPELINE_LATENCY;
+  localparam integer FIFO_WIDTH = 16 + 1 + CHANNEL_WIDTH;  // 16 bits Data + 1 bit TLast + TID
+
+  generate
+    for (genvar i = 0; i < NUM_CHANNELS; i++) begin : gen_check_weights
+      if (WEIGHTS[i] == 0) begin : gen_invalid
+        initial $fatal("axis_sigmoid_mc: channel weights must be at least 1");
+      end
+    end
+  endgenerate
+
+
+  logic [          15:0] core_data_out;
+  logic                  core_valid_out;
+
+  wire  [NUM_CHANNELS-1:0] fifo_prog_full;
+  wire                     input_accepted;
+
+  // -------------------------------------------------------------------------
+  // Arbitration
+  // -------------------------------------------------------------------------
+  // grant: Channel that was granted most recently, it keeps the pipeline while in_packet is set
+  // credits: Packets the granted channel may still start during its current turn
+  logic [CHANNEL_WIDTH-1:0] grant;
+  logic                     in_packet;
+  logic [              7:0] credits;
+
+  // Backpressure comes from the FIFO of the output each channel's beat is headed to
+  // Channels whose output is full aren't offered a new turn, but a granted channel keeps the pipeline until its packet ends
+  // Beats with an out of range tdest are accepted and dropped
+  logic [NUM_CHANNELS-1:0] dest_full;
+  wire  [NUM_CHANNELS-1:0] requesting = s_axis_tvalid & ~dest_full;
+
+  always_comb begin
+    for (int i = 0; i < NUM_CHANNELS; i++) begin
+      dest_full[i] = (int'(s_axis_tdest[i]) < NUM_CHANNELS) ? fifo_prog_full[s_axis_tdest[i]] : 1'b0;
+    end
+  end
+
+  // Channel selected this cycle, picked combinationally so there's no bubble between packets
+  logic [CHANNEL_WIDTH-1:0] selected;
+  logic                     new_turn;
+
+  always_comb begin
+    selected = grant;
+    new_turn = 1'b0;
+
+    if (!in_packet && !(credits != 0 && requesting[grant])) begin
+      // Look for the next requesting channel, starting after the last grant. The last grant itself comes last
+      new_turn = 1'b1;
+
+      for (int offset = NUM_CHANNELS; offset >= 1; offset--) begin
+        automatic int channel = (int'(grant) + offset) % NUM_CHANNELS;
+
+        if (requesting[channel]) begin
+          selected = CHANNEL_WIDTH'(channel);
+        end
+      end
+    end
+  end
+
+  wire [CHANNEL_WIDTH-1:0] selected_dest = s_axis_tdest[selected];
+
+  always_comb begin
+    s_axis_tready = '0;
+    s_axis_tready[selected] = ~dest_full[selected] && aresetn;
+  end
+
+  assign input_accepted = s_axis_tvalid[selected] && s_axis_tready[selected];
+
+  always_ff @(posedge aclk) begin
+    if (!aresetn) begin
+      grant     <= CHANNEL_WIDTH'(NUM_CHANNELS - 1);  // So that channel 0 gets the first turn
+      in_packet <= 1'b0;
+      credits   <= '0;
+    end else if (input_accepted) begin
+      grant     <= selected;
+      in_packet <= ~s_axis_tlast[selected];
+
+      // Spend a credit on the first beat of every packet
+      if (!in_packet) begin
+        credits <= (new_turn ? WEIGHTS[selected] : credits) - 1'b1;
+      end
+    end
+  end
+
+  // -------------------------------------------------------------------------
+  // TLAST & channel ID (Sideband Delay)
+  // -------------------------------------------------------------------------
+  reg [PIPELINE_LATENCY-1:0] tlast_pipe;
+  reg [CHANNEL_WIDTH-1:0] tid_pipe [PIPELINE_LATENCY];
+  reg [CHANNEL_WIDTH-1:0] tdest_pipe [PIPELINE_LATENCY];
+
+  always_ff @(posedge aclk) begin
+    if (!aresetn) begin
+      tlast_pipe <= '0;
+
+      for (int i = 0; i < PIPELINE_LATENCY; i++) begin
+        tid_pipe[i]   <= '0;
+        tdest_pipe[i] <= '0;
+      end
+    end else begin
+      tlast_pipe    <= {tlast_pipe[PIPELINE_LATENCY-2:0], s_axis_tlast[selected]};
+      tid_pipe[0]   <= selected;
+      tdest_pipe[0] <= selected_dest;
+
+      for (int i = 1; i < PIPELINE_LATENCY; i++) begin
+        tid_pipe[i]   <= tid_pipe[i-1];
+        tdest_pipe[i] <= tdest_pipe[i-1];
+      end
+    end
+  end
+
+  wire                     delayed_tlast = tlast_pipe[PIPELINE_LATENCY-1];
+  wire [CHANNEL_WIDTH-1:0] delayed_tid = tid_pipe[PIPELINE_LATENCY-1];
+  wire [CHANNEL_WIDTH-1:0] delayed_tdest = tdest_pipe[PIPELINE_LATENCY-1];
+
+
+  sigmoid_engine #(
+      .ENGINE(ENGINE),
+      .DEEP_FPU_STAGES(DEEP_FPU_STAGES),
+      .OPERAND_ISOLATION(OPERAND_ISOLATION)
+  ) inst_sigmoid (
+      .clk     (aclk),
+      .rst     (~aresetn),
+      .valid_in(input_accepted),
+      .data_in (s_axis_tdata[selected]),
+
+      .valid_out(core_valid_out),
+      .data_out (core_data_out)
+  );
+
+  // -------------------------------------------------------------------------
+  // Output routing, one FIFO per output channel
+  // -------------------------------------------------------------------------
+  generate
+    for (genvar i = 0; i < NUM_CHANNELS; i++) begin : gen_outputs
+      wire                  fifo_empty;
+      wire                  fifo_rd_en;
+      wire [FIFO_WIDTH-1:0] fifo_dout;
+
+      axis_fifo_sync #(
+          .WIDTH(FIFO_WIDTH),
+          .DEPTH(FIFO_DEPTH),
+          .PROG_FULL_THRESH(PROG_FULL_THRESH)
+      ) inst_fifo (
+          .clk      (aclk),
+          .rst      (~aresetn),
+          .wr_en    (core_valid_out && (int'(delayed_tdest) == i)),
+          .din      ({delayed_tid, delayed_tlast, core_data_out}),  // Pack: [TID | TLAST | DATA]
+          .prog_full(fifo_prog_full[i]),
+          .rd_en    (fifo_rd_en),
+          .dout     (fifo_dout),
+          .empty    (fifo_empty)
+      );
+
+      // Data un-packing
+      assign m_axis_tvalid[i] = ~fifo_empty;
+      assign fifo_rd_en       = m_axis_tvalid[i] && m_axis_tready[i];
+      assign m_axis_tid[i]    = fifo_dout[17+:CHANNEL_WIDTH];
+      assign m_axis_tdest[i]  = CHANNEL_WIDTH'(i);
+      assign m_axis_tlast[i]  = fifo_dout[16];
+      assign m_axis_tdata[i]  = fifo_dout[15:0];
+    end
+  endgenerate
+
+endmodule
@@ -9,6 +9,12 @@ package bf16_constants;
   // Largest value below 1
   localparam logic [15:0] ALMOST_ONE = 16'h3F7F; // 0.99609375
   localparam logic [15:0] ONE_POINT_FIVE = 16'h3FC0;
+  localparam logic [15:0] HALF = 16'h3F00;
+
+  localparam logic [15:0] POSITIVE_INFINITY = 16'h7F80;
+
+  // Canonical quiet NaN
+  localparam logic [15:0] QUIET_NAN = 16'h7FC0;
 
   localparam logic [15:0] MINUS_ONE = 16'h8000 | ONE;
   localparam logic [15:0] MINUS_TWO = 16'h8000 | TWO;
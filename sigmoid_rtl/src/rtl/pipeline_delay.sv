@@ -0,0 +1,42 @@
+`default_nettype none
+
+// Shift register delaying a signal by DEPTH cycles, DEPTH = 0 passes it straight through
+// Keeps valid bits and operands lined up with results coming out of multi-cycle units
+module pipeline_delay #(
+    parameter int WIDTH = 1,
+    parameter int DEPTH = 1
+) (
+    input wire clk,
+    input wire rst,
+    input wire [WIDTH-1:0] data_in,
+
+    output wire [WIDTH-1:0] data_out
+);
+    generate
+        if (DEPTH == 0) begin : gen_passthrough
+            assign data_out = data_in;
+        end
+
+        else begin : gen_delay
+            logic [WIDTH-1:0] stages [DEPTH];
+
+            always @(posedge clk) begin
+                if (rst) begin
+                    for (int i = 0; i < DEPTH; i++) begin
+                        stages[i] <= '0;
+                    end
+                end
+
+                else begin
+                    stages[0] <= data_in;
+
+                    for (int i = 1; i < DEPTH; i++) begin
+                        stages[i] <= stages[i - 1];
+                    end
+                end
+            end
+
+            assign data_out = stages[DEPTH - 1];
+        end
+    endgenerate
+endmodule
@@ -0,0 +1,65 @@
+`default_nettype none
+
+// Picks the sigmoid implementation used by the AXI-Stream wrappers
+// ENGINE = "POLYNOMIAL": sigmoid_pipelined, piecewise 2nd degree polynomial on the bf16 FPU (DSPs/logic), 6 cycles of latency
+// ENGINE = "LUT": sigmoid_lut, correctly rounded BRAM lookup table, 2 cycles of latency
+// ENGINE = "DEEP": sigmoid_pipelined_deep, same results as "POLYNOMIAL" with pipelined FPU units for higher clock speeds,
+//                  2 + 5 * DEEP_FPU_STAGES cycles of latency
+// Latencies are defined in sigmoid_pkg.sv
+// OPERAND_ISOLATION holds the "POLYNOMIAL" engine's stage registers on bubbles to save dynamic power, see sigmoid_pipelined.sv
+module sigmoid_engine #(
+    parameter ENGINE = "POLYNOMIAL",
+    parameter int DEEP_FPU_STAGES = sigmoid_pkg::SIGMOID_DEEP_FPU_STAGES,
+    parameter bit OPERAND_ISOLATION = 0
+) (
+    input wire clk,
+    input wire rst,
+    input wire valid_in,
+    input wire [15:0] data_in,
+
+    output wire valid_out,
+    output wire [15:0] data_out
+);
+    generate
+        if (ENGINE == "LUT") begin : gen_lut
+            sigmoid_lut inst_sigmoid (
+                .clk(clk),
+                .rst(rst),
+                .valid_in(valid_in),
+                .data_in(data_in),
+                .valid_out(valid_out),
+                .data_out(data_out)
+            );
+        end
+
+        else if (ENGINE == "POLYNOMIAL") begin : gen_polynomial
+            sigmoid_pipelined #(
+                .OPERAND_ISOLATION(OPERAND_ISOLATION)
+            ) inst_sigmoid (
+                .clk(clk),
+                .rst(rst),
+                .valid_in(valid_in),
+                .data_in(data_in),
+                .valid_out(valid_out),
+                .data_out(data_out)
+            );
+        end
+
+        else if (ENGINE == "DEEP") begin : gen_deep
+            sigmoid_pipelined_deep #(
+                .FPU_STAGES(DEEP_FPU_STAGES)
+            ) inst_sigmoid (
+                .clk(clk),
+                .rst(rst),
+                .valid_in(valid_in),
+                .data_in(data_in),
+                .valid_out(valid_out),
+                .data_out(data_out)
+            );
+        end
+
+        else begin : gen_invalid
+            initial $fatal("Unknown sigmoid engine. Valid engines are \"POLYNOMIAL\", \"LUT\" and \"DEEP\"");
+        end
+    endgenerate
+endmodule
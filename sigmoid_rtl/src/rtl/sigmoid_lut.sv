@@ -0,0 +1,138 @@
+`default_nettype none
+
+import bf16_constants::*;
+import sigmoid_lut_pkg::*;
+
+// Lookup table based sigmoid engine, a drop-in alternative to sigmoid_pipelined that uses BRAM instead of DSPs/logic
+// The table holds the correctly rounded sigmoid(x) for every bf16 input with 2^-8 <= |x| < 2^8, indexed directly by the input bits
+// All other inputs have a constant result, so they bypass the table:
+// - |x| < 2^-8 (including zeroes and denormals): sigmoid(x) rounds to 0.5
+// - |x| >= 2^8 (including infinities): sigmoid(x) rounds to 1.0 for positive inputs and 0.0 for negative inputs
+// - NaN: Outputs a quiet NaN
+// Pipeline stages:
+// Stage 0: Latch input, read the table (BRAM address register), classify input
+// Stage 1: Pick between the table output and the constant result
+
+// During synthesis we want pipeline stage structs to be packed for better locality/area usage
+// During Verilator testing though we want them to not be packed, so that we can easily access pipeline state in C++ code
+`ifndef PREFER_PACKED
+`ifdef VERILATOR
+    `define PREFER_PACKED
+`else
+    `define PREFER_PACKED packed
+`endif
+`endif
+
+typedef struct `PREFER_PACKED {
+    logic valid;
+    logic use_lut;
+    logic [15:0] bypass_value;
+} lut_stage0_t;
+
+typedef struct `PREFER_PACKED {
+    logic valid;
+    logic [15:0] result;
+} lut_stage1_t;
+
+module sigmoid_lut (
+    input wire clk,
+    input wire rst,
+    input wire valid_in,
+    input wire [15:0] data_in,
+
+    output wire valid_out,
+    output wire [15:0] data_out
+);
+    /* verilator public_flat_on */
+
+    // Current and next pipeline stage data
+    // Next fields are set in combinational logic, curr fields in sequential logic
+    lut_stage0_t stage0_curr, stage0_next;
+    lut_stage1_t stage1_curr, stage1_next;
+
+    /* verilator public_off */
+
+    // One cycle per stage struct above, has to agree with the latency wrappers and the C++ testbench take from sigmoid_pkg.sv
+    localparam int NUM_STAGES = 2;
+
+    generate
+        if (NUM_STAGES != sigmoid_pkg::SIGMOID_LUT_LATENCY) begin : gen_latency_mismatch
+            initial $fatal("sigmoid_lut stage count does not match SIGMOID_LUT_LATENCY in sigmoid_pkg.sv");
+        end
+    endgenerate
+
+    // Split the input into sign-exponent-mantissa
+    wire sign = data_in[15];
+    wire [7:0] exponent = data_in[14:7];
+    wire [6:0] mantissa = data_in[6:0];
+
+    // Table index: {sign, exponent - SIGMOID_LUT_EXP_MIN, mantissa}. Only meaningful when the exponent is within the table's range
+    wire [7:0] exponent_offset = exponent - 8'(SIGMOID_LUT_EXP_MIN);
+    wire [SIGMOID_LUT_ADDR_BITS-1:0] lut_index = {sign, exponent_offset[3:0], mantissa};
+
+    // The table itself, copied into a never written array so that Vivado infers a block RAM ROM from it (UG901)
+    (* rom_style = "block" *) logic [15:0] lut_rom [0:(1 << SIGMOID_LUT_ADDR_BITS) - 1] = SIGMOID_LUT;
+
+    // Stage 0: Read the table, figure out whether the input needs the table at all
+    // The table output register doubles as the BRAM output latch, so it is kept outside of the stage struct and never reset
+    logic [15:0] lut_data;
+
+    always @(posedge clk) begin
+        lut_data <= lut_rom[lut_index];
+    end
+
+    always_comb begin
+        stage0_next.valid = valid_in;
+        stage0_next.use_lut = 1'b0;
+        stage0_next.bypass_value = 16'h0000;
+
+        if (exponent == 8'hFF && mantissa != 0) begin // NaN
+            stage0_next.bypass_value = QUIET_NAN;
+        end
+
+        else if (exponent < SIGMOID_LUT_EXP_MIN) begin // |x| < 2^-8
+            stage0_next.bypass_value = HALF;
+        end
+
+        else if (exponent > SIGMOID_LUT_EXP_MAX) begin // |x| >= 2^8, saturate
+            stage0_next.bypass_value = sign ? 16'h0000 : ONE;
+        end
+
+        else begin
+            stage0_next.use_lut = 1'b1;
+        end
+    end
+
+    always @(posedge clk) begin
+        if (rst) begin
+            stage0_curr.valid <= 'd0;
+            stage0_curr.use_lut <= 'd0;
+            stage0_curr.bypass_value <= 'd0;
+        end
+
+        else begin
+            stage0_curr <= stage0_next;
+        end
+    end
+
+    // Stage 1: Select output
+    always_comb begin
+        stage1_next.valid = stage0_curr.valid;
+        stage1_next.result = stage0_curr.use_lut ? lut_data : stage0_curr.bypass_value;
+    end
+
+    always @(posedge clk) begin
+        if (rst) begin
+            stage1_curr.valid <= 'd0;
+            stage1_curr.result <= 'd0;
+        end
+
+        else begin
+            stage1_curr <= stage1_next;
+        end
+    end
+
+    // Final pipeline output
+    assign valid_out = stage1_curr.valid;
+    assign data_out = stage1_curr.result;
+endmodule
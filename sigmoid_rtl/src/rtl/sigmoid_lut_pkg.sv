@@ -0,0 +1,523 @@
+// Generated by notebooks/generate_sigmoid_lut.py, do not edit by hand
+// sigmoid(x) for every bf16 input with 2^-8 <= |x| < 2^8, rounded to nearest even
+// Indexed by {sign, exponent - SIGMOID_LUT_EXP_MIN, mantissa}
+package sigmoid_lut_pkg;
+  localparam int SIGMOID_LUT_EXP_MIN = 119;
+  localparam int SIGMOID_LUT_EXP_MAX = 134;
+  localparam int SIGMOID_LUT_ADDR_BITS = 12;
+
+  localparam logic [15:0] SIGMOID_LUT [0:4095] = '{
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00, 16'h3F00,
+    16'h3F00, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01, 16'h3F01,
+    16'h3F01, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02, 16'h3F02,
+    16'h3F02, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03,
+    16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03,
+    16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03,
+    16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03,
+    16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03,
+    16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03,
+    16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03,
+    16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03, 16'h3F03,
+    16'h3F03, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04,
+    16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04,
+    16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04,
+    16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04,
+    16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04,
+    16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04, 16'h3F04,
+    16'h3F04, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05,
+    16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05,
+    16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05,
+    16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05, 16'h3F05,
+    16'h3F05, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06,
+    16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06,
+    16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06,
+    16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06, 16'h3F06,
+    16'h3F06, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07,
+    16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07,
+    16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07,
+    16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07, 16'h3F07,
+    16'h3F07, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08,
+    16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08,
+    16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08, 16'h3F08,
+    16'h3F08, 16'h3F09, 16'h3F09, 16'h3F09, 16'h3F09, 16'h3F09, 16'h3F09, 16'h3F09,
+    16'h3F09, 16'h3F09, 16'h3F09, 16'h3F09, 16'h3F09, 16'h3F09, 16'h3F09, 16'h3F09,
+    16'h3F09, 16'h3F0A, 16'h3F0A, 16'h3F0A, 16'h3F0A, 16'h3F0A, 16'h3F0A, 16'h3F0A,
+    16'h3F0A, 16'h3F0A, 16'h3F0A, 16'h3F0A, 16'h3F0A, 16'h3F0A, 16'h3F0A, 16'h3F0A,
+    16'h3F0A, 16'h3F0B, 16'h3F0B, 16'h3F0B, 16'h3F0B, 16'h3F0B, 16'h3F0B, 16'h3F0B,
+    16'h3F0B, 16'h3F0B, 16'h3F0B, 16'h3F0B, 16'h3F0B, 16'h3F0B, 16'h3F0B, 16'h3F0B,
+    16'h3F0B, 16'h3F0C, 16'h3F0C, 16'h3F0C, 16'h3F0C, 16'h3F0C, 16'h3F0C, 16'h3F0C,
+    16'h3F0C, 16'h3F0C, 16'h3F0C, 16'h3F0C, 16'h3F0C, 16'h3F0C, 16'h3F0C, 16'h3F0C,
+    16'h3F0C, 16'h3F0D, 16'h3F0D, 16'h3F0D, 16'h3F0D, 16'h3F0D, 16'h3F0D, 16'h3F0D,
+    16'h3F0D, 16'h3F0D, 16'h3F0D, 16'h3F0D, 16'h3F0D, 16'h3F0D, 16'h3F0D, 16'h3F0D,
+    16'h3F0D, 16'h3F0E, 16'h3F0E, 16'h3F0E, 16'h3F0E, 16'h3F0E, 16'h3F0E, 16'h3F0E,
+    16'h3F0E, 16'h3F0E, 16'h3F0E, 16'h3F0E, 16'h3F0E, 16'h3F0E, 16'h3F0E, 16'h3F0E,
+    16'h3F0E, 16'h3F0E, 16'h3F0F, 16'h3F0F, 16'h3F0F, 16'h3F0F, 16'h3F0F, 16'h3F0F,
+    16'h3F0F, 16'h3F0F, 16'h3F0F, 16'h3F0F, 16'h3F0F, 16'h3F0F, 16'h3F0F, 16'h3F0F,
+    16'h3F0F, 16'h3F0F, 16'h3F10, 16'h3F10, 16'h3F10, 16'h3F10, 16'h3F10, 16'h3F10,
+    16'h3F10, 16'h3F10, 16'h3F10, 16'h3F10, 16'h3F10, 16'h3F11, 16'h3F11, 16'h3F11,
+    16'h3F11, 16'h3F11, 16'h3F11, 16'h3F11, 16'h3F11, 16'h3F12, 16'h3F12, 16'h3F12,
+    16'h3F12, 16'h3F12, 16'h3F12, 16'h3F12, 16'h3F12, 16'h3F12, 16'h3F13, 16'h3F13,
+    16'h3F13, 16'h3F13, 16'h3F13, 16'h3F13, 16'h3F13, 16'h3F13, 16'h3F14, 16'h3F14,
+    16'h3F14, 16'h3F14, 16'h3F14, 16'h3F14, 16'h3F14, 16'h3F14, 16'h3F15, 16'h3F15,
+    16'h3F15, 16'h3F15, 16'h3F15, 16'h3F15, 16'h3F15, 16'h3F15, 16'h3F16, 16'h3F16,
+    16'h3F16, 16'h3F16, 16'h3F16, 16'h3F16, 16'h3F16, 16'h3F16, 16'h3F17, 16'h3F17,
+    16'h3F17, 16'h3F17, 16'h3F17, 16'h3F17, 16'h3F17, 16'h3F17, 16'h3F17, 16'h3F18,
+    16'h3F18, 16'h3F18, 16'h3F18, 16'h3F18, 16'h3F18, 16'h3F18, 16'h3F18, 16'h3F19,
+    16'h3F19, 16'h3F19, 16'h3F19, 16'h3F19, 16'h3F19, 16'h3F19, 16'h3F19, 16'h3F1A,
+    16'h3F1A, 16'h3F1A, 16'h3F1A, 16'h3F1A, 16'h3F1A, 16'h3F1A, 16'h3F1A, 16'h3F1A,
+    16'h3F1B, 16'h3F1B, 16'h3F1B, 16'h3F1B, 16'h3F1B, 16'h3F1B, 16'h3F1B, 16'h3F1B,
+    16'h3F1C, 16'h3F1C, 16'h3F1C, 16'h3F1C, 16'h3F1C, 16'h3F1C, 16'h3F1C, 16'h3F1C,
+    16'h3F1D, 16'h3F1D, 16'h3F1D, 16'h3F1D, 16'h3F1D, 16'h3F1D, 16'h3F1D, 16'h3F1D,
+    16'h3F1D, 16'h3F1E, 16'h3F1E, 16'h3F1E, 16'h3F1E, 16'h3F1E, 16'h3F1E, 16'h3F1E,
+    16'h3F1E, 16'h3F1F, 16'h3F1F, 16'h3F1F, 16'h3F1F, 16'h3F1F, 16'h3F1F, 16'h3F1F,
+    16'h3F1F, 16'h3F20, 16'h3F20, 16'h3F20, 16'h3F20, 16'h3F21, 16'h3F21, 16'h3F21,
+    16'h3F21, 16'h3F21, 16'h3F22, 16'h3F22, 16'h3F22, 16'h3F22, 16'h3F23, 16'h3F23,
+    16'h3F23, 16'h3F23, 16'h3F24, 16'h3F24, 16'h3F24, 16'h3F24, 16'h3F24, 16'h3F25,
+    16'h3F25, 16'h3F25, 16'h3F25, 16'h3F26, 16'h3F26, 16'h3F26, 16'h3F26, 16'h3F27,
+    16'h3F27, 16'h3F27, 16'h3F27, 16'h3F27, 16'h3F28, 16'h3F28, 16'h3F28, 16'h3F28,
+    16'h3F29, 16'h3F29, 16'h3F29, 16'h3F29, 16'h3F29, 16'h3F2A, 16'h3F2A, 16'h3F2A,
+    16'h3F2A, 16'h3F2B, 16'h3F2B, 16'h3F2B, 16'h3F2B, 16'h3F2B, 16'h3F2C, 16'h3F2C,
+    16'h3F2C, 16'h3F2C, 16'h3F2D, 16'h3F2D, 16'h3F2D, 16'h3F2D, 16'h3F2D, 16'h3F2E,
+    16'h3F2E, 16'h3F2E, 16'h3F2E, 16'h3F2F, 16'h3F2F, 16'h3F2F, 16'h3F2F, 16'h3F2F,
+    16'h3F30, 16'h3F30, 16'h3F30, 16'h3F30, 16'h3F30, 16'h3F31, 16'h3F31, 16'h3F31,
+    16'h3F31, 16'h3F32, 16'h3F32, 16'h3F32, 16'h3F32, 16'h3F32, 16'h3F33, 16'h3F33,
+    16'h3F33, 16'h3F33, 16'h3F33, 16'h3F34, 16'h3F34, 16'h3F34, 16'h3F34, 16'h3F34,
+    16'h3F35, 16'h3F35, 16'h3F35, 16'h3F35, 16'h3F36, 16'h3F36, 16'h3F36, 16'h3F36,
+    16'h3F36, 16'h3F37, 16'h3F37, 16'h3F37, 16'h3F37, 16'h3F37, 16'h3F38, 16'h3F38,
+    16'h3F38, 16'h3F38, 16'h3F38, 16'h3F39, 16'h3F39, 16'h3F39, 16'h3F39, 16'h3F39,
+    16'h3F3A, 16'h3F3A, 16'h3F3A, 16'h3F3A, 16'h3F3A, 16'h3F3B, 16'h3F3B, 16'h3F3B,
+    16'h3F3B, 16'h3F3C, 16'h3F3C, 16'h3F3C, 16'h3F3D, 16'h3F3D, 16'h3F3D, 16'h3F3E,
+    16'h3F3E, 16'h3F3F, 16'h3F3F, 16'h3F3F, 16'h3F40, 16'h3F40, 16'h3F41, 16'h3F41,
+    16'h3F41, 16'h3F42, 16'h3F42, 16'h3F42, 16'h3F43, 16'h3F43, 16'h3F43, 16'h3F44,
+    16'h3F44, 16'h3F45, 16'h3F45, 16'h3F45, 16'h3F46, 16'h3F46, 16'h3F46, 16'h3F47,
+    16'h3F47, 16'h3F47, 16'h3F48, 16'h3F48, 16'h3F48, 16'h3F49, 16'h3F49, 16'h3F49,
+    16'h3F4A, 16'h3F4A, 16'h3F4A, 16'h3F4B, 16'h3F4B, 16'h3F4B, 16'h3F4C, 16'h3F4C,
+    16'h3F4C, 16'h3F4D, 16'h3F4D, 16'h3F4D, 16'h3F4E, 16'h3F4E, 16'h3F4E, 16'h3F4F,
+    16'h3F4F, 16'h3F4F, 16'h3F4F, 16'h3F50, 16'h3F50, 16'h3F50, 16'h3F51, 16'h3F51,
+    16'h3F51, 16'h3F52, 16'h3F52, 16'h3F52, 16'h3F52, 16'h3F53, 16'h3F53, 16'h3F53,
+    16'h3F54, 16'h3F54, 16'h3F54, 16'h3F54, 16'h3F55, 16'h3F55, 16'h3F55, 16'h3F56,
+    16'h3F56, 16'h3F56, 16'h3F56, 16'h3F57, 16'h3F57, 16'h3F57, 16'h3F58, 16'h3F58,
+    16'h3F58, 16'h3F58, 16'h3F59, 16'h3F59, 16'h3F59, 16'h3F59, 16'h3F5A, 16'h3F5A,
+    16'h3F5A, 16'h3F5A, 16'h3F5B, 16'h3F5B, 16'h3F5B, 16'h3F5B, 16'h3F5C, 16'h3F5C,
+    16'h3F5C, 16'h3F5C, 16'h3F5D, 16'h3F5D, 16'h3F5D, 16'h3F5D, 16'h3F5D, 16'h3F5E,
+    16'h3F5E, 16'h3F5E, 16'h3F5E, 16'h3F5F, 16'h3F5F, 16'h3F5F, 16'h3F5F, 16'h3F60,
+    16'h3F60, 16'h3F60, 16'h3F60, 16'h3F60, 16'h3F61, 16'h3F61, 16'h3F61, 16'h3F61,
+    16'h3F61, 16'h3F62, 16'h3F62, 16'h3F63, 16'h3F63, 16'h3F64, 16'h3F64, 16'h3F64,
+    16'h3F65, 16'h3F65, 16'h3F65, 16'h3F66, 16'h3F66, 16'h3F67, 16'h3F67, 16'h3F67,
+    16'h3F68, 16'h3F68, 16'h3F68, 16'h3F69, 16'h3F69, 16'h3F69, 16'h3F6A, 16'h3F6A,
+    16'h3F6A, 16'h3F6B, 16'h3F6B, 16'h3F6B, 16'h3F6B, 16'h3F6C, 16'h3F6C, 16'h3F6C,
+    16'h3F6D, 16'h3F6D, 16'h3F6D, 16'h3F6D, 16'h3F6E, 16'h3F6E, 16'h3F6E, 16'h3F6E,
+    16'h3F6F, 16'h3F6F, 16'h3F6F, 16'h3F6F, 16'h3F70, 16'h3F70, 16'h3F70, 16'h3F70,
+    16'h3F71, 16'h3F71, 16'h3F71, 16'h3F71, 16'h3F71, 16'h3F72, 16'h3F72, 16'h3F72,
+    16'h3F72, 16'h3F73, 16'h3F73, 16'h3F73, 16'h3F73, 16'h3F73, 16'h3F73, 16'h3F74,
+    16'h3F74, 16'h3F74, 16'h3F74, 16'h3F74, 16'h3F75, 16'h3F75, 16'h3F75, 16'h3F75,
+    16'h3F75, 16'h3F75, 16'h3F76, 16'h3F76, 16'h3F76, 16'h3F76, 16'h3F76, 16'h3F76,
+    16'h3F76, 16'h3F77, 16'h3F77, 16'h3F77, 16'h3F77, 16'h3F77, 16'h3F77, 16'h3F77,
+    16'h3F78, 16'h3F78, 16'h3F78, 16'h3F78, 16'h3F78, 16'h3F78, 16'h3F78, 16'h3F78,
+    16'h3F78, 16'h3F79, 16'h3F79, 16'h3F79, 16'h3F79, 16'h3F79, 16'h3F79, 16'h3F79,
+    16'h3F79, 16'h3F79, 16'h3F7A, 16'h3F7A, 16'h3F7A, 16'h3F7A, 16'h3F7A, 16'h3F7A,
+    16'h3F7A, 16'h3F7A, 16'h3F7A, 16'h3F7A, 16'h3F7A, 16'h3F7B, 16'h3F7B, 16'h3F7B,
+    16'h3F7B, 16'h3F7B, 16'h3F7B, 16'h3F7B, 16'h3F7B, 16'h3F7B, 16'h3F7B, 16'h3F7B,
+    16'h3F7B, 16'h3F7C, 16'h3F7C, 16'h3F7C, 16'h3F7C, 16'h3F7C, 16'h3F7C, 16'h3F7C,
+    16'h3F7C, 16'h3F7D, 16'h3F7D, 16'h3F7D, 16'h3F7D, 16'h3F7D, 16'h3F7D, 16'h3F7D,
+    16'h3F7D, 16'h3F7D, 16'h3F7D, 16'h3F7D, 16'h3F7E, 16'h3F7E, 16'h3F7E, 16'h3F7E,
+    16'h3F7E, 16'h3F7E, 16'h3F7E, 16'h3F7E, 16'h3F7E, 16'h3F7E, 16'h3F7E, 16'h3F7E,
+    16'h3F7E, 16'h3F7E, 16'h3F7E, 16'h3F7E, 16'h3F7E, 16'h3F7F, 16'h3F7F, 16'h3F7F,
+    16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F,
+    16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F,
+    16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F,
+    16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F, 16'h3F7F,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80, 16'h3F80,
+    16'h3F00, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF, 16'h3EFF,
+    16'h3EFF, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE, 16'h3EFE,
+    16'h3EFE, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD,
+    16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD,
+    16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD,
+    16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD,
+    16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD,
+    16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD,
+    16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD,
+    16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD, 16'h3EFD,
+    16'h3EFD, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC,
+    16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC,
+    16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC,
+    16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC,
+    16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC,
+    16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC, 16'h3EFC,
+    16'h3EFC, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB,
+    16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB,
+    16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB,
+    16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB, 16'h3EFB,
+    16'h3EFB, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA,
+    16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA,
+    16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA,
+    16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA, 16'h3EFA,
+    16'h3EFA, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9,
+    16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9,
+    16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9,
+    16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9, 16'h3EF9,
+    16'h3EF9, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8,
+    16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8,
+    16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8, 16'h3EF8,
+    16'h3EF8, 16'h3EF7, 16'h3EF7, 16'h3EF7, 16'h3EF7, 16'h3EF7, 16'h3EF7, 16'h3EF7,
+    16'h3EF7, 16'h3EF7, 16'h3EF7, 16'h3EF7, 16'h3EF7, 16'h3EF7, 16'h3EF7, 16'h3EF7,
+    16'h3EF7, 16'h3EF6, 16'h3EF6, 16'h3EF6, 16'h3EF6, 16'h3EF6, 16'h3EF6, 16'h3EF6,
+    16'h3EF6, 16'h3EF6, 16'h3EF6, 16'h3EF6, 16'h3EF6, 16'h3EF6, 16'h3EF6, 16'h3EF6,
+    16'h3EF6, 16'h3EF5, 16'h3EF5, 16'h3EF5, 16'h3EF5, 16'h3EF5, 16'h3EF5, 16'h3EF5,
+    16'h3EF5, 16'h3EF5, 16'h3EF5, 16'h3EF5, 16'h3EF5, 16'h3EF5, 16'h3EF5, 16'h3EF5,
+    16'h3EF5, 16'h3EF4, 16'h3EF4, 16'h3EF4, 16'h3EF4, 16'h3EF4, 16'h3EF4, 16'h3EF4,
+    16'h3EF4, 16'h3EF4, 16'h3EF4, 16'h3EF4, 16'h3EF4, 16'h3EF4, 16'h3EF4, 16'h3EF4,
+    16'h3EF4, 16'h3EF3, 16'h3EF3, 16'h3EF3, 16'h3EF3, 16'h3EF3, 16'h3EF3, 16'h3EF3,
+    16'h3EF3, 16'h3EF3, 16'h3EF3, 16'h3EF3, 16'h3EF3, 16'h3EF3, 16'h3EF3, 16'h3EF3,
+    16'h3EF3, 16'h3EF2, 16'h3EF2, 16'h3EF2, 16'h3EF2, 16'h3EF2, 16'h3EF2, 16'h3EF2,
+    16'h3EF2, 16'h3EF2, 16'h3EF2, 16'h3EF2, 16'h3EF2, 16'h3EF2, 16'h3EF2, 16'h3EF2,
+    16'h3EF2, 16'h3EF1, 16'h3EF1, 16'h3EF1, 16'h3EF1, 16'h3EF1, 16'h3EF1, 16'h3EF1,
+    16'h3EF1, 16'h3EF1, 16'h3EF1, 16'h3EF1, 16'h3EF1, 16'h3EF1, 16'h3EF1, 16'h3EF1,
+    16'h3EF1, 16'h3EF0, 16'h3EF0, 16'h3EF0, 16'h3EF0, 16'h3EF0, 16'h3EF0, 16'h3EF0,
+    16'h3EF0, 16'h3EF0, 16'h3EF0, 16'h3EF0, 16'h3EF0, 16'h3EEF, 16'h3EEF, 16'h3EEF,
+    16'h3EEF, 16'h3EEF, 16'h3EEF, 16'h3EEF, 16'h3EEF, 16'h3EEE, 16'h3EEE, 16'h3EEE,
+    16'h3EEE, 16'h3EEE, 16'h3EEE, 16'h3EEE, 16'h3EEE, 16'h3EED, 16'h3EED, 16'h3EED,
+    16'h3EED, 16'h3EED, 16'h3EED, 16'h3EED, 16'h3EED, 16'h3EEC, 16'h3EEC, 16'h3EEC,
+    16'h3EEC, 16'h3EEC, 16'h3EEC, 16'h3EEC, 16'h3EEC, 16'h3EEB, 16'h3EEB, 16'h3EEB,
+    16'h3EEB, 16'h3EEB, 16'h3EEB, 16'h3EEB, 16'h3EEB, 16'h3EEA, 16'h3EEA, 16'h3EEA,
+    16'h3EEA, 16'h3EEA, 16'h3EEA, 16'h3EEA, 16'h3EEA, 16'h3EE9, 16'h3EE9, 16'h3EE9,
+    16'h3EE9, 16'h3EE9, 16'h3EE9, 16'h3EE9, 16'h3EE9, 16'h3EE8, 16'h3EE8, 16'h3EE8,
+    16'h3EE8, 16'h3EE8, 16'h3EE8, 16'h3EE8, 16'h3EE8, 16'h3EE7, 16'h3EE7, 16'h3EE7,
+    16'h3EE7, 16'h3EE7, 16'h3EE7, 16'h3EE7, 16'h3EE7, 16'h3EE6, 16'h3EE6, 16'h3EE6,
+    16'h3EE6, 16'h3EE6, 16'h3EE6, 16'h3EE6, 16'h3EE6, 16'h3EE5, 16'h3EE5, 16'h3EE5,
+    16'h3EE5, 16'h3EE5, 16'h3EE5, 16'h3EE5, 16'h3EE5, 16'h3EE4, 16'h3EE4, 16'h3EE4,
+    16'h3EE4, 16'h3EE4, 16'h3EE4, 16'h3EE4, 16'h3EE4, 16'h3EE3, 16'h3EE3, 16'h3EE3,
+    16'h3EE3, 16'h3EE3, 16'h3EE3, 16'h3EE3, 16'h3EE3, 16'h3EE3, 16'h3EE2, 16'h3EE2,
+    16'h3EE2, 16'h3EE2, 16'h3EE2, 16'h3EE2, 16'h3EE2, 16'h3EE2, 16'h3EE1, 16'h3EE1,
+    16'h3EE1, 16'h3EE1, 16'h3EE1, 16'h3EE1, 16'h3EE1, 16'h3EE1, 16'h3EE0, 16'h3EE0,
+    16'h3EE0, 16'h3EE0, 16'h3EE0, 16'h3EDF, 16'h3EDF, 16'h3EDF, 16'h3EDF, 16'h3EDE,
+    16'h3EDE, 16'h3EDE, 16'h3EDE, 16'h3EDD, 16'h3EDD, 16'h3EDD, 16'h3EDD, 16'h3EDC,
+    16'h3EDC, 16'h3EDC, 16'h3EDC, 16'h3EDC, 16'h3EDB, 16'h3EDB, 16'h3EDB, 16'h3EDB,
+    16'h3EDA, 16'h3EDA, 16'h3EDA, 16'h3EDA, 16'h3ED9, 16'h3ED9, 16'h3ED9, 16'h3ED9,
+    16'h3ED8, 16'h3ED8, 16'h3ED8, 16'h3ED8, 16'h3ED7, 16'h3ED7, 16'h3ED7, 16'h3ED7,
+    16'h3ED6, 16'h3ED6, 16'h3ED6, 16'h3ED6, 16'h3ED5, 16'h3ED5, 16'h3ED5, 16'h3ED5,
+    16'h3ED4, 16'h3ED4, 16'h3ED4, 16'h3ED4, 16'h3ED3, 16'h3ED3, 16'h3ED3, 16'h3ED3,
+    16'h3ED2, 16'h3ED2, 16'h3ED2, 16'h3ED2, 16'h3ED2, 16'h3ED1, 16'h3ED1, 16'h3ED1,
+    16'h3ED1, 16'h3ED0, 16'h3ED0, 16'h3ED0, 16'h3ED0, 16'h3ECF, 16'h3ECF, 16'h3ECF,
+    16'h3ECF, 16'h3ECE, 16'h3ECE, 16'h3ECE, 16'h3ECE, 16'h3ECD, 16'h3ECD, 16'h3ECD,
+    16'h3ECD, 16'h3ECC, 16'h3ECC, 16'h3ECC, 16'h3ECC, 16'h3ECC, 16'h3ECB, 16'h3ECB,
+    16'h3ECB, 16'h3ECB, 16'h3ECA, 16'h3ECA, 16'h3ECA, 16'h3ECA, 16'h3EC9, 16'h3EC9,
+    16'h3EC9, 16'h3EC9, 16'h3EC8, 16'h3EC8, 16'h3EC8, 16'h3EC8, 16'h3EC7, 16'h3EC7,
+    16'h3EC7, 16'h3EC7, 16'h3EC6, 16'h3EC6, 16'h3EC6, 16'h3EC6, 16'h3EC6, 16'h3EC5,
+    16'h3EC5, 16'h3EC5, 16'h3EC5, 16'h3EC4, 16'h3EC4, 16'h3EC4, 16'h3EC4, 16'h3EC3,
+    16'h3EC3, 16'h3EC3, 16'h3EC3, 16'h3EC2, 16'h3EC2, 16'h3EC2, 16'h3EC2, 16'h3EC2,
+    16'h3EC1, 16'h3EC1, 16'h3EC0, 16'h3EC0, 16'h3EBF, 16'h3EBF, 16'h3EBE, 16'h3EBE,
+    16'h3EBE, 16'h3EBD, 16'h3EBD, 16'h3EBC, 16'h3EBC, 16'h3EBB, 16'h3EBB, 16'h3EBA,
+    16'h3EBA, 16'h3EB9, 16'h3EB9, 16'h3EB8, 16'h3EB8, 16'h3EB8, 16'h3EB7, 16'h3EB7,
+    16'h3EB6, 16'h3EB6, 16'h3EB5, 16'h3EB5, 16'h3EB4, 16'h3EB4, 16'h3EB3, 16'h3EB3,
+    16'h3EB3, 16'h3EB2, 16'h3EB2, 16'h3EB1, 16'h3EB1, 16'h3EB0, 16'h3EB0, 16'h3EAF,
+    16'h3EAF, 16'h3EAE, 16'h3EAE, 16'h3EAE, 16'h3EAD, 16'h3EAD, 16'h3EAC, 16'h3EAC,
+    16'h3EAB, 16'h3EAB, 16'h3EAA, 16'h3EAA, 16'h3EAA, 16'h3EA9, 16'h3EA9, 16'h3EA8,
+    16'h3EA8, 16'h3EA7, 16'h3EA7, 16'h3EA6, 16'h3EA6, 16'h3EA6, 16'h3EA5, 16'h3EA5,
+    16'h3EA4, 16'h3EA4, 16'h3EA3, 16'h3EA3, 16'h3EA3, 16'h3EA2, 16'h3EA2, 16'h3EA1,
+    16'h3EA1, 16'h3EA0, 16'h3EA0, 16'h3EA0, 16'h3E9F, 16'h3E9F, 16'h3E9E, 16'h3E9E,
+    16'h3E9D, 16'h3E9D, 16'h3E9D, 16'h3E9C, 16'h3E9C, 16'h3E9B, 16'h3E9B, 16'h3E9A,
+    16'h3E9A, 16'h3E9A, 16'h3E99, 16'h3E99, 16'h3E98, 16'h3E98, 16'h3E97, 16'h3E97,
+    16'h3E97, 16'h3E96, 16'h3E96, 16'h3E95, 16'h3E95, 16'h3E95, 16'h3E94, 16'h3E94,
+    16'h3E93, 16'h3E93, 16'h3E93, 16'h3E92, 16'h3E92, 16'h3E91, 16'h3E91, 16'h3E90,
+    16'h3E90, 16'h3E90, 16'h3E8F, 16'h3E8F, 16'h3E8E, 16'h3E8E, 16'h3E8E, 16'h3E8D,
+    16'h3E8D, 16'h3E8C, 16'h3E8C, 16'h3E8C, 16'h3E8B, 16'h3E8B, 16'h3E8A, 16'h3E8A,
+    16'h3E8A, 16'h3E89, 16'h3E88, 16'h3E87, 16'h3E87, 16'h3E86, 16'h3E85, 16'h3E84,
+    16'h3E83, 16'h3E83, 16'h3E82, 16'h3E81, 16'h3E80, 16'h3E7F, 16'h3E7E, 16'h3E7C,
+    16'h3E7B, 16'h3E79, 16'h3E78, 16'h3E77, 16'h3E75, 16'h3E74, 16'h3E72, 16'h3E71,
+    16'h3E6F, 16'h3E6E, 16'h3E6C, 16'h3E6B, 16'h3E6A, 16'h3E68, 16'h3E67, 16'h3E65,
+    16'h3E64, 16'h3E63, 16'h3E61, 16'h3E60, 16'h3E5F, 16'h3E5D, 16'h3E5C, 16'h3E5A,
+    16'h3E59, 16'h3E58, 16'h3E56, 16'h3E55, 16'h3E54, 16'h3E53, 16'h3E51, 16'h3E50,
+    16'h3E4F, 16'h3E4D, 16'h3E4C, 16'h3E4B, 16'h3E4A, 16'h3E48, 16'h3E47, 16'h3E46,
+    16'h3E45, 16'h3E43, 16'h3E42, 16'h3E41, 16'h3E40, 16'h3E3E, 16'h3E3D, 16'h3E3C,
+    16'h3E3B, 16'h3E3A, 16'h3E38, 16'h3E37, 16'h3E36, 16'h3E35, 16'h3E34, 16'h3E33,
+    16'h3E31, 16'h3E30, 16'h3E2F, 16'h3E2E, 16'h3E2D, 16'h3E2C, 16'h3E2B, 16'h3E2A,
+    16'h3E28, 16'h3E27, 16'h3E26, 16'h3E25, 16'h3E24, 16'h3E23, 16'h3E22, 16'h3E21,
+    16'h3E20, 16'h3E1F, 16'h3E1E, 16'h3E1D, 16'h3E1C, 16'h3E1B, 16'h3E1A, 16'h3E19,
+    16'h3E18, 16'h3E17, 16'h3E16, 16'h3E15, 16'h3E14, 16'h3E13, 16'h3E12, 16'h3E11,
+    16'h3E10, 16'h3E0F, 16'h3E0E, 16'h3E0D, 16'h3E0C, 16'h3E0B, 16'h3E0A, 16'h3E09,
+    16'h3E08, 16'h3E07, 16'h3E06, 16'h3E05, 16'h3E05, 16'h3E04, 16'h3E03, 16'h3E02,
+    16'h3E01, 16'h3E00, 16'h3DFE, 16'h3DFD, 16'h3DFB, 16'h3DF9, 16'h3DF8, 16'h3DF6,
+    16'h3DF4, 16'h3DF1, 16'h3DED, 16'h3DEA, 16'h3DE7, 16'h3DE4, 16'h3DE1, 16'h3DDE,
+    16'h3DDB, 16'h3DD7, 16'h3DD4, 16'h3DD2, 16'h3DCF, 16'h3DCC, 16'h3DC9, 16'h3DC6,
+    16'h3DC3, 16'h3DC1, 16'h3DBE, 16'h3DBB, 16'h3DB9, 16'h3DB6, 16'h3DB3, 16'h3DB1,
+    16'h3DAE, 16'h3DAC, 16'h3DA9, 16'h3DA7, 16'h3DA5, 16'h3DA2, 16'h3DA0, 16'h3D9E,
+    16'h3D9B, 16'h3D99, 16'h3D97, 16'h3D95, 16'h3D93, 16'h3D91, 16'h3D8E, 16'h3D8C,
+    16'h3D8A, 16'h3D88, 16'h3D86, 16'h3D84, 16'h3D82, 16'h3D81, 16'h3D7D, 16'h3D7A,
+    16'h3D76, 16'h3D73, 16'h3D6F, 16'h3D6B, 16'h3D68, 16'h3D65, 16'h3D61, 16'h3D5E,
+    16'h3D5B, 16'h3D58, 16'h3D54, 16'h3D51, 16'h3D4E, 16'h3D4B, 16'h3D48, 16'h3D45,
+    16'h3D42, 16'h3D3F, 16'h3D3D, 16'h3D3A, 16'h3D37, 16'h3D34, 16'h3D32, 16'h3D2F,
+    16'h3D2C, 16'h3D2A, 16'h3D27, 16'h3D25, 16'h3D22, 16'h3D20, 16'h3D1E, 16'h3D1B,
+    16'h3D19, 16'h3D17, 16'h3D14, 16'h3D12, 16'h3D10, 16'h3D0E, 16'h3D0C, 16'h3D0A,
+    16'h3D08, 16'h3D05, 16'h3D03, 16'h3D02, 16'h3CFF, 16'h3CFB, 16'h3CF8, 16'h3CF4,
+    16'h3CF0, 16'h3CED, 16'h3CE9, 16'h3CE5, 16'h3CE2, 16'h3CDF, 16'h3CDB, 16'h3CD8,
+    16'h3CD5, 16'h3CD1, 16'h3CCE, 16'h3CCB, 16'h3CC8, 16'h3CC5, 16'h3CC2, 16'h3CBF,
+    16'h3CBC, 16'h3CB9, 16'h3CB7, 16'h3CB4, 16'h3CB1, 16'h3CAE, 16'h3CAC, 16'h3CA9,
+    16'h3CA7, 16'h3CA4, 16'h3CA2, 16'h3C9F, 16'h3C9D, 16'h3C9A, 16'h3C98, 16'h3C96,
+    16'h3C93, 16'h3C8F, 16'h3C8B, 16'h3C86, 16'h3C82, 16'h3C7D, 16'h3C75, 16'h3C6E,
+    16'h3C66, 16'h3C5F, 16'h3C59, 16'h3C52, 16'h3C4C, 16'h3C45, 16'h3C3F, 16'h3C3A,
+    16'h3C34, 16'h3C2F, 16'h3C29, 16'h3C24, 16'h3C1F, 16'h3C1A, 16'h3C16, 16'h3C11,
+    16'h3C0D, 16'h3C08, 16'h3C04, 16'h3C00, 16'h3BF8, 16'h3BF1, 16'h3BE9, 16'h3BE2,
+    16'h3BDB, 16'h3BD5, 16'h3BCE, 16'h3BC8, 16'h3BC2, 16'h3BBC, 16'h3BB6, 16'h3BB0,
+    16'h3BAB, 16'h3BA6, 16'h3BA1, 16'h3B9C, 16'h3B97, 16'h3B92, 16'h3B8E, 16'h3B8A,
+    16'h3B85, 16'h3B81, 16'h3B7B, 16'h3B73, 16'h3B6C, 16'h3B64, 16'h3B5D, 16'h3B57,
+    16'h3B50, 16'h3B4A, 16'h3B43, 16'h3B3D, 16'h3B38, 16'h3B32, 16'h3B2C, 16'h3B27,
+    16'h3B22, 16'h3B1D, 16'h3B18, 16'h3B14, 16'h3B0F, 16'h3B0B, 16'h3B06, 16'h3B02,
+    16'h3AFD, 16'h3AF5, 16'h3AED, 16'h3AE6, 16'h3ADF, 16'h3AD8, 16'h3AD1, 16'h3ACB,
+    16'h3AC5, 16'h3ABF, 16'h3AB9, 16'h3AB3, 16'h3AAE, 16'h3AA8, 16'h3AA3, 16'h3A9E,
+    16'h3A99, 16'h3A95, 16'h3A90, 16'h3A8C, 16'h3A87, 16'h3A83, 16'h3A7E, 16'h3A76,
+    16'h3A6F, 16'h3A67, 16'h3A60, 16'h3A59, 16'h3A53, 16'h3A4C, 16'h3A46, 16'h3A40,
+    16'h3A3A, 16'h3A34, 16'h3A2F, 16'h3A29, 16'h3A24, 16'h3A1F, 16'h3A1A, 16'h3A16,
+    16'h3A11, 16'h3A0C, 16'h3A08, 16'h3A04, 16'h3A00, 16'h39F8, 16'h39F0, 16'h39E9,
+    16'h39E2, 16'h39DB, 16'h39D4, 16'h39CE, 16'h39C7, 16'h39C1, 16'h39BB, 16'h39B5,
+    16'h39B0, 16'h39A5, 16'h399B, 16'h3992, 16'h3989, 16'h3981, 16'h3972, 16'h3963,
+    16'h3955, 16'h3948, 16'h393C, 16'h3931, 16'h3926, 16'h391C, 16'h3913, 16'h390A,
+    16'h3901, 16'h38F3, 16'h38E4, 16'h38D7, 16'h38CA, 16'h38BD, 16'h38B2, 16'h38A7,
+    16'h389D, 16'h3893, 16'h388B, 16'h3882, 16'h3874, 16'h3866, 16'h3858, 16'h384B,
+    16'h383E, 16'h3833, 16'h3828, 16'h381E, 16'h3814, 16'h380B, 16'h3803, 16'h37F6,
+    16'h37E7, 16'h37D9, 16'h37CC, 16'h37BF, 16'h37B4, 16'h37A9, 16'h379F, 16'h3795,
+    16'h378C, 16'h3784, 16'h3777, 16'h3768, 16'h375A, 16'h374D, 16'h3741, 16'h3735,
+    16'h372A, 16'h3720, 16'h3716, 16'h370D, 16'h3704, 16'h36F9, 16'h36EA, 16'h36DB,
+    16'h36CE, 16'h36C2, 16'h36B6, 16'h36AB, 16'h36A1, 16'h3697, 16'h368E, 16'h3685,
+    16'h367A, 16'h366B, 16'h365D, 16'h364F, 16'h3643, 16'h3637, 16'h362C, 16'h3621,
+    16'h3618, 16'h360E, 16'h3606, 16'h35FC, 16'h35EC, 16'h35DE, 16'h35D1, 16'h35C4,
+    16'h35B8, 16'h35AD, 16'h35A2, 16'h3599, 16'h358F, 16'h3587, 16'h357D, 16'h356E,
+    16'h355F, 16'h3552, 16'h3545, 16'h3539, 16'h352E, 16'h3523, 16'h3519, 16'h3510,
+    16'h3507, 16'h34FE, 16'h34EF, 16'h34E0, 16'h34D3, 16'h34C6, 16'h34BA, 16'h34AF,
+    16'h34A4, 16'h349A, 16'h3491, 16'h3488, 16'h3480, 16'h3470, 16'h3462, 16'h3454,
+    16'h3447, 16'h343B, 16'h3430, 16'h3425, 16'h341B, 16'h3412, 16'h3409, 16'h3401,
+    16'h33F2, 16'h33D5, 16'h33BC, 16'h33A6, 16'h3393, 16'h3381, 16'h3364, 16'h3349,
+    16'h3332, 16'h331D, 16'h330A, 16'h32F4, 16'h32D8, 16'h32BE, 16'h32A8, 16'h3294,
+    16'h3283, 16'h3267, 16'h324C, 16'h3234, 16'h321F, 16'h320C, 16'h31F7, 16'h31DA,
+    16'h31C1, 16'h31AA, 16'h3196, 16'h3184, 16'h316A, 16'h314E, 16'h3136, 16'h3121,
+    16'h310E, 16'h30FA, 16'h30DD, 16'h30C3, 16'h30AC, 16'h3098, 16'h3086, 16'h306C,
+    16'h3050, 16'h3038, 16'h3022, 16'h300F, 16'h2FFD, 16'h2FDF, 16'h2FC5, 16'h2FAE,
+    16'h2F99, 16'h2F87, 16'h2F6F, 16'h2F53, 16'h2F3A, 16'h2F24, 16'h2F11, 16'h2F00,
+    16'h2EE2, 16'h2EC7, 16'h2EB0, 16'h2E9B, 16'h2E89, 16'h2E72, 16'h2E55, 16'h2E3C,
+    16'h2E26, 16'h2E13, 16'h2E01, 16'h2DE4, 16'h2DC9, 16'h2DB2, 16'h2D9D, 16'h2D8A,
+    16'h2D74, 16'h2D58, 16'h2D3E, 16'h2D28, 16'h2D14, 16'h2D03, 16'h2CE7, 16'h2CCC,
+    16'h2CB4, 16'h2C9F, 16'h2C8C, 16'h2C77, 16'h2C5A, 16'h2C40, 16'h2C2A, 16'h2C16,
+    16'h2C04, 16'h2BE9, 16'h2BCE, 16'h2BB6, 16'h2BA0, 16'h2B8E, 16'h2B7A, 16'h2B5D,
+    16'h2B43, 16'h2B2C, 16'h2B18, 16'h2B06, 16'h2AEC, 16'h2AD0, 16'h2AB8, 16'h2AA2,
+    16'h2A8F, 16'h2A7D, 16'h2A5F, 16'h2A45, 16'h2A2E, 16'h2A19, 16'h2A07, 16'h29EF,
+    16'h29D3, 16'h29BA, 16'h29A4, 16'h2991, 16'h2980, 16'h2962, 16'h2947, 16'h2930,
+    16'h291B, 16'h2909, 16'h28F1, 16'h28D5, 16'h28BC, 16'h28A6, 16'h2892, 16'h2881,
+    16'h2864, 16'h2832, 16'h280A, 16'h27D8, 16'h27A8, 16'h2783, 16'h274C, 16'h271F,
+    16'h26F7, 16'h26C0, 16'h2696, 16'h2669, 16'h2636, 16'h260E, 16'h25DC, 16'h25AC,
+    16'h2586, 16'h2550, 16'h2522, 16'h24FD, 16'h24C5, 16'h2499, 16'h246F, 16'h243A,
+    16'h2411, 16'h23E1, 16'h23B0, 16'h2389, 16'h2355, 16'h2326, 16'h2301, 16'h22C9,
+    16'h229D, 16'h2274, 16'h223E, 16'h2214, 16'h21E7, 16'h21B4, 16'h218C, 16'h215A,
+    16'h212A, 16'h2104, 16'h20CE, 16'h20A0, 16'h207A, 16'h2042, 16'h2017, 16'h1FEC,
+    16'h1FB8, 16'h1F8F, 16'h1F5F, 16'h1F2E, 16'h1F07, 16'h1ED3, 16'h1EA4, 16'h1E7F,
+    16'h1E47, 16'h1E1B, 16'h1DF1, 16'h1DBC, 16'h1D92, 16'h1D64, 16'h1D32, 16'h1D0A,
+    16'h1CD7, 16'h1CA8, 16'h1C83, 16'h1C4B, 16'h1C1E, 16'h1BF7, 16'h1BC0, 16'h1B96,
+    16'h1B69, 16'h1B36, 16'h1B0D, 16'h1ADC, 16'h1AAC, 16'h1A86, 16'h1A50, 16'h1A22,
+    16'h19FC, 16'h19C5, 16'h1999, 16'h196E, 16'h193A, 16'h1911, 16'h18E1, 16'h18AF,
+    16'h1889, 16'h1855, 16'h1826, 16'h1801, 16'h17C9, 16'h179D, 16'h1774, 16'h173E,
+    16'h1714, 16'h16E6, 16'h16B3, 16'h168C, 16'h165A, 16'h162A, 16'h1604, 16'h15CE,
+    16'h15A0, 16'h157A, 16'h1542, 16'h1517, 16'h14EC, 16'h14B8, 16'h148F, 16'h145F,
+    16'h142D, 16'h1407, 16'h13D2, 16'h13A4, 16'h137F, 16'h1347, 16'h131B, 16'h12F1,
+    16'h12BC, 16'h1292, 16'h1264, 16'h1231, 16'h120A, 16'h11D7, 16'h11A8, 16'h1183,
+    16'h114B, 16'h10F7, 16'h1096, 16'h1035, 16'h0FDC, 16'h0F86, 16'h0F22, 16'h0EC4,
+    16'h0E6E, 16'h0E11, 16'h0DAF, 16'h0D55, 16'h0D01, 16'h0C9C, 16'h0C3E, 16'h0BE6,
+    16'h0B8C, 16'h0B29, 16'h0ACE, 16'h0A79, 16'h0A17, 16'h09B7, 16'h095F, 16'h0907,
+    16'h08A4, 16'h0847, 16'h07F1, 16'h0792, 16'h0731, 16'h06D7, 16'h0682, 16'h061E,
+    16'h05C0, 16'h0569, 16'h050D, 16'h04AB, 16'h0450, 16'h03FC, 16'h0399, 16'h0339,
+    16'h02E1, 16'h0288, 16'h0226, 16'h01C9, 16'h0174, 16'h0114, 16'h00B3, 16'h006D,
+    16'h0042, 16'h0028, 16'h0018, 16'h000F, 16'h0009, 16'h0005, 16'h0003, 16'h0002,
+    16'h0001, 16'h0001, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000,
+    16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000, 16'h0000
+  };
+endpackage : sigmoid_lut_pkg
@@ -0,0 +1,104 @@
+`default_nettype none
+
+import sigmoid_pkg::*;
+
+// Converts bf16 sigmoid results to a narrower output format and packs several of them into every output beat
+// See sigmoid_pkg.sv for the formats. Results fill a beat starting from the least significant bits, so the first result of
+// a beat lands at the lowest address once a DMA writes it to memory
+// A beat goes out once it's full, or early on a result with last_in set. keep_out flags the bytes holding results, so the
+// final beat of a packet may be partially filled
+// Pipeline stages (SIGMOID_OUTPUT_PACK_LATENCY = 2 cycles until a beat goes out):
+// Stage 0: Convert the result
+// Stage 1: Place it in its lane, send the beat out if it's full or the last one
+// bf16 results in 16-bit beats are passed straight through with no added latency
+module sigmoid_output_packer #(
+    parameter int FORMAT = SIGMOID_FORMAT_BF16,
+    parameter int BEAT_WIDTH = 16
+) (
+    input wire clk,
+    input wire rst,
+    input wire valid_in,
+    input wire last_in,
+    input wire [15:0] data_in,
+
+    output logic valid_out,
+    output logic last_out,
+    output logic [BEAT_WIDTH-1:0] data_out,
+    output logic [BEAT_WIDTH/8-1:0] keep_out
+);
+    localparam int FORMAT_WIDTH = sigmoid_format_width(FORMAT);
+    localparam int LANES = BEAT_WIDTH / FORMAT_WIDTH;
+    localparam int LANE_BYTES = FORMAT_WIDTH / 8;
+    localparam int LANE_INDEX_WIDTH = (LANES > 1) ? $clog2(LANES) : 1;
+
+    generate
+        if (BEAT_WIDTH % FORMAT_WIDTH != 0 || LANES < 1) begin : gen_invalid
+            initial $fatal("sigmoid_output_packer: BEAT_WIDTH must be a multiple of the output format's width");
+        end
+
+        if (sigmoid_output_latency(FORMAT, BEAT_WIDTH) == 0) begin : gen_passthrough
+            assign valid_out = valid_in;
+            assign last_out = last_in;
+            assign data_out = data_in;
+            assign keep_out = '1;
+        end
+
+        else begin : gen_packer
+            // Stage 0: Convert
+            logic converted_valid, converted_last;
+            logic [FORMAT_WIDTH-1:0] converted;
+
+            always @(posedge clk) begin
+                if (rst) begin
+                    converted_valid <= 1'b0;
+                    converted_last <= 1'b0;
+                    converted <= '0;
+                end
+
+                else begin
+                    converted_valid <= valid_in;
+                    converted_last <= last_in;
+                    converted <= FORMAT_WIDTH'(sigmoid_convert_output(FORMAT, data_in));
+                end
+            end
+
+            // Stage 1: Pack
+            logic [LANE_INDEX_WIDTH-1:0] lane;
+            logic [BEAT_WIDTH-1:0] beat, beat_next;
+            logic beat_done;
+
+            always_comb begin
+                beat_next = (lane == 0) ? '0 : beat;
+                beat_next[lane * FORMAT_WIDTH +: FORMAT_WIDTH] = converted;
+                beat_done = (int'(lane) == LANES - 1) || converted_last;
+            end
+
+            always @(posedge clk) begin
+                if (rst) begin
+                    lane <= '0;
+                    beat <= '0;
+                    valid_out <= 1'b0;
+                    last_out <= 1'b0;
+                    data_out <= '0;
+                    keep_out <= '0;
+                end
+
+                else begin
+                    valid_out <= converted_valid && beat_done;
+
+                    if (converted_valid) begin
+                        beat <= beat_next;
+                        lane <= beat_done ? '0 : lane + 1'b1;
+
+                        if (beat_done) begin
+                            last_out <= converted_last;
+                            data_out <= beat_next;
+                            // Built at full width, an integer shift would overflow with 32 or more bytes per beat
+                            keep_out <= {(BEAT_WIDTH/8){1'b1}} >> (BEAT_WIDTH/8 - (int'(lane) + 1) * LANE_BYTES);
+                        end
+                    end
+                end
+            end
+        end
+    endgenerate
+endmodule
@@ -2,6 +2,7 @@
 
 import bf16_constants::*;
 import lampFPU_pkg::*;
+import sigmoid_pkg::*;
 
 // Pipelined version of the single-cycle sigmoid module
 // Pipeline stages:
@@ -11,14 +12,19 @@ import lampFPU_pkg::*;
 // Stage 3: Calculate a2 * (x + offset) ^ 2 and a1 * (x + offset) = a0
 // Stage 4: Calculate final polynomial sum
 // Stage 5: Calculate flipped value (1.0 - sigmoid(|x|)), choose output based on the input sign
+// With OPERAND_ISOLATION set, a stage's registers only load when the data coming into it is valid. Bubbles just clear the
+// valid bit, so every FPU keeps seeing the operands of the last valid input and the combinational chains stop toggling while
+// idle. Results are the same either way, only data_out differs while valid_out is low (it holds the last result)
 
 // During synthesis we want pipeline stage structs to be packed for better locality/area usage
 // During Verilator testing though we want them to not be packed, so that we can easily access pipeline state in C++ code
+`ifndef PREFER_PACKED
 `ifdef VERILATOR
     `define PREFER_PACKED
 `else
     `define PREFER_PACKED packed
 `endif
+`endif
 
 typedef struct `PREFER_PACKED {
     logic valid;
@@ -70,7 +76,9 @@ typedef struct `PREFER_PACKED {
 // For |x| > 6, we consider f(x) = ~0.9999
 // We compute the function based on the absolute value of x, and use sigmoid symmetry to calculate it for negative values
 // Ie sigmoid(-x) = 1 - sigmoid(x)
-module sigmoid_pipelined (
+module sigmoid_pipelined #(
+    parameter bit OPERAND_ISOLATION = 0
+) (
     input wire clk,
     input wire rst,
     input wire valid_in,
@@ -92,6 +100,16 @@ module sigmoid_pipelined (
 
     /* verilator public_off */
 
+    // One cycle per stage struct above. Wrappers and the C++ testbench size themselves from SIGMOID_POLY_LATENCY instead,
+    // so adding or removing a stage has to update sigmoid_pkg.sv too
+    localparam int NUM_STAGES = 6;
+
+    generate
+        if (NUM_STAGES != SIGMOID_POLY_LATENCY) begin : gen_latency_mismatch
+            initial $fatal("sigmoid_pipelined stage count does not match SIGMOID_POLY_LATENCY in sigmoid_pkg.sv");
+        end
+    endgenerate
+
     // Absolute value and sign of the input
     wire [15:0] data_in_abs = {1'b0, data_in[14:0]};
     wire is_negative = data_in[15];
@@ -110,7 +128,7 @@ module sigmoid_pipelined (
     // Generate comparators
     genvar i;
     generate
-        for (i = 0; i < 6; i++) begin
+        for (i = 0; i < 6; i++) begin : gen_less_than
             bf16_cmp_lt cmp (
                 .op1(stage0_curr.x_abs),
                 .op2(cmp_values[i]),
@@ -122,50 +140,14 @@ module sigmoid_pipelined (
 
     // Pick a set of polynomial coefficients based on the value of |x|
     always_comb begin
-        // TODO: Generate for loop
-        if (less_than[0]) begin // |x| < 1
-            {a2, a1, a0} = {16'hBCE4, 16'h3E85, 16'h3F00}; // -0.027832031, 0.25976563, 0.5
-            offset = 16'h0000;
-        end
-
-        else if (less_than[1]) begin // |x| < 2
-            {a2, a1, a0} = {16'hBD3F, 16'h3E49, 16'h3F3B}; // -0.04663086, 0.19628906, 0.73046875
-            offset = MINUS_ONE;
-        end
-
-        else if (less_than[2]) begin // |x| < 3
-            {a2, a1, a0} = {16'hBCF4, 16'h3DCF, 16'h3F62}; // -0.029785156, 0.10107422, 0.8828125
-            offset = MINUS_TWO;
-        end
-
-        else if (less_than[3]) begin // |x| < 4
-            {a2, a1, a0} = {16'hBC5E, 16'h3D2E, 16'h3F74}; // -0.013549805, 0.04248047, 0.953125
-            offset = MINUS_THREE;
-        end
-
-        else if (less_than[4]) begin // |x| < 5
-            {a2, a1, a0} = {16'hBBB2, 16'h3C87, 16'h3F7B}; // -0.005432129, 0.016479492, 0.98046875
-            offset = MINUS_FOUR;
-        end
-
-        else if (less_than[5]) begin // |x| < 6
-            {a2, a1, a0} = {16'hBB06, 16'h3BCB, 16'h3F7E}; // -0.0020446777, 0.0061950684, 0.9921875
-            offset = MINUS_FIVE;
-        end
-
-        else begin
-            // |x| > 6 approaches one asymptotically
-            // TODO: NaNs, Infinities
-            {a2, a1, a0} = {16'd0, 16'd0, ONE};
-            offset = 16'd0;
-        end
+        {a2, a1, a0, offset} = sigmoid_poly_coefficients(less_than);
     end
 
     // Stage 0: Fetch input, absolute value, sign
     always_comb begin
         stage0_next.valid = valid_in;
         stage0_next.is_negative = is_negative;
-        stage0_next.x_abs = data_in_abs;
+        stage0_next.x_abs = sigmoid_clamp_abs(data_in_abs);
     end
 
     always @(posedge clk) begin
@@ -175,9 +157,13 @@ module sigmoid_pipelined (
             stage0_curr.x_abs <= 'd0;
         end
 
-        else begin
+        else if (stage0_next.valid || !OPERAND_ISOLATION) begin
             stage0_curr <= stage0_next;
         end
+
+        else begin
+            stage0_curr.valid <= 1'b0;
+        end
     end
 
     // Stage 1: Calculate x + offset and figure out polynomial coefficients
@@ -209,9 +195,13 @@ module sigmoid_pipelined (
             stage1_curr.a2 <= 'd0;
         end
 
-        else begin
+        else if (stage1_next.valid || !OPERAND_ISOLATION) begin
             stage1_curr <= stage1_next;
         end
+
+        else begin
+            stage1_curr.valid <= 1'b0;
+        end
     end
 
     // Stage 2: Calculate (x + offset) ^ 2 and a1 * (x + offset)
@@ -252,9 +242,13 @@ module sigmoid_pipelined (
             stage2_curr.a2 <= 'd0;
         end
 
-        else begin
+        else if (stage2_next.valid || !OPERAND_ISOLATION) begin
             stage2_curr <= stage2_next;
         end
+
+        else begin
+            stage2_curr.valid <= 1'b0;
+        end
     end
 
     // Stage 3: Calculate a2 * (x + offset) ^ 2 and a1 * (x + offset) = a0
@@ -291,9 +285,13 @@ module sigmoid_pipelined (
             stage3_curr.add_a0_a1 <= 'd0;
         end
 
-        else begin
+        else if (stage3_next.valid || !OPERAND_ISOLATION) begin
             stage3_curr <= stage3_next;
         end
+
+        else begin
+            stage3_curr.valid <= 1'b0;
+        end
     end
 
     // Stage 4: Calculate final polynomial value
@@ -316,9 +314,14 @@ module sigmoid_pipelined (
             stage4_curr.is_negative <= 'd0;
             stage4_curr.poly_result <= 'd0;
         end
-        else begin
+
+        else if (stage4_next.valid || !OPERAND_ISOLATION) begin
             stage4_curr <= stage4_next;
         end
+
+        else begin
+            stage4_curr.valid <= 1'b0;
+        end
     end
 
     // Stage 5: Calculate 1.0 - polynomial value and select output based on the sign of the input
@@ -342,9 +345,14 @@ module sigmoid_pipelined (
             stage5_curr.valid <= 'd0;
             stage5_curr.result <= 'd0;
         end
-        else begin
+
+        else if (stage5_next.valid || !OPERAND_ISOLATION) begin
             stage5_curr <= stage5_next;
         end
+
+        else begin
+            stage5_curr.valid <= 1'b0;
+        end
     end
 
     // Final pipeline output
@@ -0,0 +1,235 @@
+`default_nettype none
+
+import bf16_constants::*;
+import sigmoid_pkg::*;
+
+// Deeper pipelined version of sigmoid_pipelined, for higher clock speeds
+// sigmoid_pipelined fits a whole bf16 add/mul (alignment, mantissa add/multiply, normalization and rounding) in each stage,
+// which limits its fmax. This variant computes the same polynomial with the pipelined units from bf16_pipelined_units.sv,
+// spending FPU_STAGES cycles on every FPU operation. Results are bit-identical to sigmoid_pipelined
+// Pipeline stages (LATENCY = 2 + 5 * FPU_STAGES cycles, 12 by default):
+// Input: Latch |x| & sign, pick polynomial coefficients
+// FPU op 1: Calculate x + offset
+// FPU op 2: Calculate (x + offset) ^ 2 and a1 * (x + offset)
+// FPU op 3: Calculate a2 * (x + offset) ^ 2 and a1 * (x + offset) + a0
+// FPU op 4: Calculate final polynomial sum
+// FPU op 5: Calculate flipped value (1.0 - sigmoid(|x|))
+// Output: Choose output based on the input sign
+// Signals that skip FPU operations (valid, sign, coefficients) travel through delay lines matching the FPU latency
+
+`ifndef PREFER_PACKED
+`ifdef VERILATOR
+    `define PREFER_PACKED
+`else
+    `define PREFER_PACKED packed
+`endif
+`endif
+
+typedef struct `PREFER_PACKED {
+    logic valid;
+    logic is_negative;
+    logic [15:0] x_abs;
+    logic [15:0] offset;
+    logic [15:0] a0;
+    logic [15:0] a1;
+    logic [15:0] a2;
+} deep_input_stage_t;
+
+typedef struct `PREFER_PACKED {
+    logic valid;
+    logic [15:0] result;
+} deep_output_stage_t;
+
+module sigmoid_pipelined_deep #(
+    parameter int FPU_STAGES = SIGMOID_DEEP_FPU_STAGES
+) (
+    input wire clk,
+    input wire rst,
+    input wire valid_in,
+    input wire [15:0] data_in,
+
+    output wire valid_out,
+    output wire [15:0] data_out
+);
+    localparam int LATENCY = sigmoid_deep_latency(FPU_STAGES);
+
+    /* verilator public_flat_on */
+
+    // Current and next state of the first and last stage
+    // Next fields are set in combinational logic, curr fields in sequential logic
+    deep_input_stage_t input_curr, input_next;
+    deep_output_stage_t output_curr, output_next;
+
+    // FPU results
+    logic [15:0] x_offset;
+    logic [15:0] x_squared;
+    logic [15:0] mul_a1_x;
+    logic [15:0] mul_a2_x2;
+    logic [15:0] add_a0_a1;
+    logic [15:0] poly_result;
+    logic [15:0] one_minus_polynomial_output;
+
+    /* verilator public_off */
+
+    // Input stage: Latch |x| and its sign, compare |x| against 1, 2, ..., 6 straight away to pick the coefficients
+    wire [15:0] data_in_abs = {1'b0, data_in[14:0]};
+
+    localparam [15:0] cmp_values [5:0] = { SIX, FIVE, FOUR, THREE, TWO, ONE };  // Indices are reversed, so ONE is at index 0 and so on
+    wire [5:0] less_than;
+
+    genvar i;
+    generate
+        for (i = 0; i < 6; i++) begin
+            bf16_cmp_lt cmp (
+                .op1(data_in_abs),
+                .op2(cmp_values[i]),
+                .cmp_o(less_than[i]),
+                .isCmpValid_o()
+            );
+        end
+    endgenerate
+
+    always_comb begin
+        input_next.valid = valid_in;
+        input_next.is_negative = data_in[15];
+        input_next.x_abs = sigmoid_clamp_abs(data_in_abs);
+        {input_next.a2, input_next.a1, input_next.a0, input_next.offset} = sigmoid_poly_coefficients(less_than);
+    end
+
+    always @(posedge clk) begin
+        if (rst) begin
+            input_curr.valid <= 'd0;
+            input_curr.is_negative <= 'd0;
+            input_curr.x_abs <= 'd0;
+            input_curr.offset <= 'd0;
+            input_curr.a0 <= 'd0;
+            input_curr.a1 <= 'd0;
+            input_curr.a2 <= 'd0;
+        end
+
+        else begin
+            input_curr <= input_next;
+        end
+    end
+
+    // Delay lines for everything that waits on FPU results
+    // valid & sign wait for all 5 FPU operations, a1 for 1 and a0/a2 for 2
+    wire valid_delayed, is_negative_delayed;
+    wire [15:0] a1_delayed, a0_delayed, a2_delayed;
+    wire [15:0] poly_result_delayed;
+
+    pipeline_delay #(
+        .WIDTH(2),
+        .DEPTH(LATENCY - SIGMOID_DEEP_FIXED_STAGES)
+    ) delay_valid (
+        .clk(clk),
+        .rst(rst),
+        .data_in({input_curr.valid, input_curr.is_negative}),
+        .data_out({valid_delayed, is_negative_delayed})
+    );
+
+    pipeline_delay #(
+        .WIDTH(16),
+        .DEPTH(FPU_STAGES)
+    ) delay_a1 (
+        .clk(clk),
+        .rst(rst),
+        .data_in(input_curr.a1),
+        .data_out(a1_delayed)
+    );
+
+    pipeline_delay #(
+        .WIDTH(32),
+        .DEPTH(2 * FPU_STAGES)
+    ) delay_a0_a2 (
+        .clk(clk),
+        .rst(rst),
+        .data_in({input_curr.a0, input_curr.a2}),
+        .data_out({a0_delayed, a2_delayed})
+    );
+
+    // FPU op 1: x_offset = x + offset
+    bf16_add_pipelined #(.STAGES(FPU_STAGES)) add1 (
+        .clk(clk),
+        .op1(input_curr.x_abs),
+        .op2(input_curr.offset),
+        .result(x_offset)
+    );
+
+    // FPU op 2: x_squared = (x + offset)^2, mul_a1_x = a1 * (x + offset)
+    bf16_mul_pipelined #(.STAGES(FPU_STAGES)) mul1 (
+        .clk(clk),
+        .op1(x_offset),
+        .op2(x_offset),
+        .result(x_squared)
+    );
+
+    bf16_mul_pipelined #(.STAGES(FPU_STAGES)) mul2 (
+        .clk(clk),
+        .op1(a1_delayed),
+        .op2(x_offset),
+        .result(mul_a1_x)
+    );
+
+    // FPU op 3: mul_a2_x2 = a2 * (x + offset)^2, add_a0_a1 = a0 + a1 * (x + offset)
+    bf16_mul_pipelined #(.STAGES(FPU_STAGES)) mul3 (
+        .clk(clk),
+        .op1(a2_delayed),
+        .op2(x_squared),
+        .result(mul_a2_x2)
+    );
+
+    bf16_add_pipelined #(.STAGES(FPU_STAGES)) add2 (
+        .clk(clk),
+        .op1(a0_delayed),
+        .op2(mul_a1_x),
+        .result(add_a0_a1)
+    );
+
+    // FPU op 4: Final polynomial value
+    bf16_add_pipelined #(.STAGES(FPU_STAGES)) add3 (
+        .clk(clk),
+        .op1(add_a0_a1),
+        .op2(mul_a2_x2),
+        .result(poly_result)
+    );
+
+    // FPU op 5: 1.0 - polynomial value. The polynomial value itself is delayed alongside, for positive inputs
+    bf16_sub_pipelined #(.STAGES(FPU_STAGES)) flip_poly (
+        .clk(clk),
+        .op1(ONE),
+        .op2(poly_result),
+        .result(one_minus_polynomial_output)
+    );
+
+    pipeline_delay #(
+        .WIDTH(16),
+        .DEPTH(FPU_STAGES)
+    ) delay_poly (
+        .clk(clk),
+        .rst(rst),
+        .data_in(poly_result),
+        .data_out(poly_result_delayed)
+    );
+
+    // Output stage: Select output based on the sign of the input
+    always_comb begin
+        output_next.valid = valid_delayed;
+        output_next.result = (is_negative_delayed == 0) ? poly_result_delayed : one_minus_polynomial_output;
+    end
+
+    always @(posedge clk) begin
+        if (rst) begin
+            output_curr.valid <= 'd0;
+            output_curr.result <= 'd0;
+        end
+
+        else begin
+            output_curr <= output_next;
+        end
+    end
+
+    // Final pipeline output
+    assign valid_out = output_curr.valid;
+    assign data_out = output_curr.result;
+endmodule
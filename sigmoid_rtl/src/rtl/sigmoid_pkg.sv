@@ -0,0 +1,148 @@
+// Latencies of our sigmoid engines, in cycles from valid_in being sampled to valid_out going high
+// Wrappers (axis_sigmoid, silu_pipelined) size their sideband delay lines from these, and the C++ testbench generates its
+// pipeline stage constants from the localparam int lines of this file, so keep every latency here as a plain integer expression
+package sigmoid_pkg;
+  import bf16_constants::*;
+
+  localparam int SIGMOID_POLY_LATENCY = 6;
+  localparam int SIGMOID_LUT_LATENCY = 2;
+
+  // sigmoid_pipelined_deep: 1 input/coefficient select stage + 5 chained FPU operations + 1 output select stage
+  // Each FPU operation takes SIGMOID_DEEP_FPU_STAGES cycles (1 to 3, see bf16_pipelined_units.sv)
+  localparam int SIGMOID_DEEP_FPU_STAGES = 2;
+  localparam int SIGMOID_DEEP_FIXED_STAGES = 2;
+  localparam int SIGMOID_DEEP_FPU_DEPTH = 5;
+  localparam int SIGMOID_DEEP_LATENCY = SIGMOID_DEEP_FIXED_STAGES + SIGMOID_DEEP_FPU_DEPTH * SIGMOID_DEEP_FPU_STAGES;
+
+  // Latency of sigmoid_pipelined_deep when its FPU_STAGES parameter is overridden
+  function automatic int sigmoid_deep_latency(input int fpu_stages);
+    return SIGMOID_DEEP_FIXED_STAGES + SIGMOID_DEEP_FPU_DEPTH * fpu_stages;
+  endfunction
+
+  // Output formats of the AXI-Stream wrapper (OUTPUT_FORMAT parameter). Sigmoid results lie in [0, 1], so the narrower formats
+  // drop the sign and most of the exponent range, and several results get packed into every output beat
+  // BF16: Unchanged 16-bit bfloat16
+  // UQ0_8, UQ0_16: Unsigned fixed point, value = code / 2^N. 1.0 saturates to the largest code (1 - 2^-N)
+  // FP8_E4M3: OCP FP8, 4 exponent bits (bias 7), 3 mantissa bits. No infinities, out of range values saturate to 448
+  // FP8_E5M2: OCP FP8, 5 exponent bits (bias 15), 2 mantissa bits
+  // Conversions round to nearest even. Negative values (only ever -0) and bf16 denormals give 0, NaNs give 0 in the fixed
+  // point formats and a quiet NaN in FP8
+  localparam int SIGMOID_FORMAT_BF16 = 0;
+  localparam int SIGMOID_FORMAT_UQ0_8 = 1;
+  localparam int SIGMOID_FORMAT_UQ0_16 = 2;
+  localparam int SIGMOID_FORMAT_FP8_E4M3 = 3;
+  localparam int SIGMOID_FORMAT_FP8_E5M2 = 4;
+
+  // Cycles the output converter/packer adds after the sigmoid engine, when it isn't bypassed (see sigmoid_output_latency)
+  localparam int SIGMOID_OUTPUT_PACK_LATENCY = 2;
+
+  function automatic int sigmoid_format_width(input int format);
+    return (format == SIGMOID_FORMAT_BF16 || format == SIGMOID_FORMAT_UQ0_16) ? 16 : 8;
+  endfunction
+
+  // bf16 outputs in beats of 16 bits need no conversion nor packing, so they skip the packer altogether
+  function automatic int sigmoid_output_latency(input int format, input int beat_width);
+    return (format == SIGMOID_FORMAT_BF16 && beat_width == 16) ? 0 : SIGMOID_OUTPUT_PACK_LATENCY;
+  endfunction
+
+  // value / 2^shift, rounded to nearest even
+  function automatic int unsigned sigmoid_shift_rne(input int unsigned value, input int shift);
+    int unsigned quotient, remainder, half;
+
+    if (shift <= 0) return value << -shift;
+    if (shift > 16) return 0;  // Our values are at most 9 bits wide, so they round to 0
+
+    quotient = value >> shift;
+    remainder = value & ((1 << shift) - 1);
+    half = 1 << (shift - 1);
+
+    if (remainder > half || (remainder == half && quotient[0])) begin
+      quotient++;
+    end
+
+    return quotient;
+  endfunction
+
+  // Convert a bf16 sigmoid result to one of the formats above. The result sits in the low bits
+  function automatic logic [15:0] sigmoid_convert_output(input int format, input logic [15:0] value);
+    int exponent, shift, fraction_bits, bias, max_code, code;
+    int unsigned significand;  // 1.mantissa, scaled by 2^7
+
+    if (format == SIGMOID_FORMAT_BF16) return value;
+
+    exponent = value[14:7];
+    significand = {1'b1, value[6:0]};
+
+    if (exponent == 255 && value[6:0] != 0) begin
+      return (format == SIGMOID_FORMAT_FP8_E4M3 || format == SIGMOID_FORMAT_FP8_E5M2) ? 16'h007F : 16'h0000;
+    end
+
+    if (value[15] || exponent == 0) return 16'h0000;
+
+    if (format == SIGMOID_FORMAT_UQ0_8 || format == SIGMOID_FORMAT_UQ0_16) begin
+      // value * 2^N = significand * 2^(exponent - 127 - 7 + N)
+      fraction_bits = sigmoid_format_width(format);
+      shift = 127 + 7 - fraction_bits - exponent;
+
+      if (exponent >= 127) return (1 << fraction_bits) - 1;  // 1.0 and above
+      code = sigmoid_shift_rne(significand, shift);
+      return (code >= (1 << fraction_bits)) ? (1 << fraction_bits) - 1 : code;
+    end
+
+    // FP8. Encodings are ordered like the values they represent, so normals are built as ((exponent - 1) << M) + significand,
+    // letting a rounding carry out of the significand bump the exponent. Subnormals are just the shifted significand
+    fraction_bits = (format == SIGMOID_FORMAT_FP8_E4M3) ? 3 : 2;
+    bias = (format == SIGMOID_FORMAT_FP8_E4M3) ? 7 : 15;
+    max_code = (format == SIGMOID_FORMAT_FP8_E4M3) ? 8'h7E : 8'h7C;  // 448 for E4M3, infinity for E5M2
+    exponent = exponent - 127 + bias;
+
+    if (exponent >= 1) begin
+      code = ((exponent - 1) << fraction_bits) + sigmoid_shift_rne(significand, 7 - fraction_bits);
+    end else begin
+      code = sigmoid_shift_rne(significand, 8 - fraction_bits - exponent);
+    end
+
+    return (code > max_code) ? max_code : code;
+  endfunction
+
+  // |x| >= 6 takes the constant branch of the polynomial (a2 = a1 = 0, a0 = 1), but the FPUs still square x + offset, so huge
+  // inputs and infinities would end up as 0 * infinity = NaN. Clamping them to 6 keeps every intermediate value finite
+  // Non-negative bf16 values are ordered like unsigned integers. NaNs are left alone
+  function automatic logic [15:0] sigmoid_clamp_abs(input logic [15:0] x_abs);
+    return (x_abs >= SIX && x_abs <= POSITIVE_INFINITY) ? SIX : x_abs;
+  endfunction
+
+  // Coefficients of the piecewise 2nd degree polynomial approximation, shared by the pipelined engines
+  // less_than[i] is set when |x| < i + 1. Returns {a2, a1, a0, offset}
+  function automatic logic [63:0] sigmoid_poly_coefficients(input logic [5:0] less_than);
+    if (less_than[0]) begin // |x| < 1
+      return {16'hBCE4, 16'h3E85, 16'h3F00, 16'h0000}; // -0.027832031, 0.25976563, 0.5
+    end
+
+    else if (less_than[1]) begin // |x| < 2
+      return {16'hBD3F, 16'h3E49, 16'h3F3B, MINUS_ONE}; // -0.04663086, 0.19628906, 0.73046875
+    end
+
+    else if (less_than[2]) begin // |x| < 3
+      return {16'hBCF4, 16'h3DCF, 16'h3F62, MINUS_TWO}; // -0.029785156, 0.10107422, 0.8828125
+    end
+
+    else if (less_than[3]) begin // |x| < 4
+      return {16'hBC5E, 16'h3D2E, 16'h3F74, MINUS_THREE}; // -0.013549805, 0.04248047, 0.953125
+    end
+
+    else if (less_than[4]) begin // |x| < 5
+      return {16'hBBB2, 16'h3C87, 16'h3F7B, MINUS_FOUR}; // -0.005432129, 0.016479492, 0.98046875
+    end
+
+    else if (less_than[5]) begin // |x| < 6
+      return {16'hBB06, 16'h3BCB, 16'h3F7E, MINUS_FIVE}; // -0.0020446777, 0.0061950684, 0.9921875
+    end
+
+    else begin
+      // |x| > 6 approaches one asymptotically. Infinities are clamped to 6 before getting here (sigmoid_clamp_abs), NaNs fail
+      // every comparison and propagate through the FPUs to a NaN result
+      return {16'd0, 16'd0, ONE, 16'd0};
+    end
+  endfunction
+endpackage : sigmoid_pkg
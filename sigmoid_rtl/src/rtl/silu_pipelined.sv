@@ -1,7 +1,9 @@
 `default_nettype none
 
+import sigmoid_pkg::*;
+
 // Module implementing the SiLU activation function, using our pipelined sigmoid module
-// Our SiLU module has 6 + 1 = 7 pipeline stages
+// Our SiLU module has SIGMOID_POLY_LATENCY + 1 = 7 pipeline stages
 module silu_pipelined (
     input wire clk,
     input wire rst,
@@ -23,10 +25,10 @@ module silu_pipelined (
         .data_out(sigmoid_out)
     );
 
-    // Our sigmoid module has a 6-stage pipeline
+    // Our sigmoid module has a SIGMOID_POLY_LATENCY-stage pipeline (see sigmoid_pkg.sv)
     // Thus, we need to pipeline our SiLU module's valid_in and data_in input signals the same way,
     // + 1 extra cycle to compute SiLU(x) = x * sigmoid(x)
-    localparam SIGMOID_PIPELINE_STAGES = 6;
+    localparam SIGMOID_PIPELINE_STAGES = SIGMOID_POLY_LATENCY;
     localparam SILU_PIPELINE_STAGES = SIGMOID_PIPELINE_STAGES + 1;
 
     logic valid_in_pipeline [(SILU_PIPELINE_STAGES - 1):0];
@@ -0,0 +1,91 @@
+#ifndef SIGMOID_BF16_H
+#define SIGMOID_BF16_H
+
+#include <stddef.h>
+#include <string.h>
+
+#include "xil_types.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define SIGMOID_BF16_NEON
+#endif
+
+/* float32 <-> bfloat16 conversions for preparing sigmoid inputs and reading back results
+ * Rounding matches bf16::fromFloat in the C++ testbench: round to nearest even, NaNs are kept and made quiet
+ * The array versions convert 8 values at a time with NEON when the compiler targets it (-mfpu=neon on the Cortex-A9, always on AArch64)
+ */
+
+static inline u16 f32_to_bf16(float value)
+{
+    u32 bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    if ((bits & 0x7FFFFFFFu) > 0x7F800000u) {
+        /* NaN: keep the upper payload bits and make it quiet, so truncating the payload can't turn it into an infinity */
+        return (u16)((bits >> 16) | 0x40u);
+    }
+
+    /* Adding 0x7FFF rounds up when the discarded half is above 0x8000, the LSB of the result breaks ties */
+    return (u16)((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16);
+}
+
+static inline float bf16_to_f32(u16 value)
+{
+    u32   bits = (u32)value << 16;
+    float result;
+
+    memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+#ifdef SIGMOID_BF16_NEON
+/* Same rounding as f32_to_bf16, 4 values at a time. Mirrors the NEON kernel of the C++ testbench (bf16_convert.cpp),
+ * and only uses instructions both the Zynq-7000's Cortex-A9 and the 64-bit Cortex-A53 have
+ */
+static inline uint32x4_t f32_to_bf16_neon(uint32x4_t bits)
+{
+    const uint32x4_t lsb = vandq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(1));
+    const uint32x4_t rounded = vshrq_n_u32(vaddq_u32(bits, vaddq_u32(lsb, vdupq_n_u32(0x7FFF))), 16);
+    const uint32x4_t quiet_nan = vorrq_u32(vshrq_n_u32(bits, 16), vdupq_n_u32(0x40));
+    const uint32x4_t is_nan = vcgtq_u32(vandq_u32(bits, vdupq_n_u32(0x7FFFFFFF)), vdupq_n_u32(0x7F800000));
+
+    return vbslq_u32(is_nan, quiet_nan, rounded);
+}
+#endif
+
+static inline void f32_to_bf16_array(const float *input, u16 *output, size_t count)
+{
+    size_t i = 0;
+
+#ifdef SIGMOID_BF16_NEON
+    for (; i + 8 <= count; i += 8) {
+        const uint32x4_t low = f32_to_bf16_neon(vreinterpretq_u32_f32(vld1q_f32(input + i)));
+        const uint32x4_t high = f32_to_bf16_neon(vreinterpretq_u32_f32(vld1q_f32(input + i + 4)));
+        vst1q_u16(output + i, vcombine_u16(vmovn_u32(low), vmovn_u32(high)));
+    }
+#endif
+
+    for (; i < count; i++) {
+        output[i] = f32_to_bf16(input[i]);
+    }
+}
+
+static inline void bf16_to_f32_array(const u16 *input, float *output, size_t count)
+{
+    size_t i = 0;
+
+#ifdef SIGMOID_BF16_NEON
+    for (; i + 8 <= count; i += 8) {
+        const uint16x8_t values = vld1q_u16(input + i);
+        vst1q_f32(output + i, vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(values), 16)));
+        vst1q_f32(output + i + 4, vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(values), 16)));
+    }
+#endif
+
+    for (; i < count; i++) {
+        output[i] = bf16_to_f32(input[i]);
+    }
+}
+
+#endif /* SIGMOID_BF16_H */
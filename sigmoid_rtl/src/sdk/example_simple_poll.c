@@ -5,11 +5,15 @@
 #include "xiltimer.h"
 #include "xparameters.h"
 
+#include <math.h>
 #include <sleep.h>
 #include <stdio.h>
 
 #include <xaxidma_hw.h>
 
+#include "bf16.h"
+#include "sigmoid_output.h"
+
 /******************** Constant Definitions **********************************/
 
 #ifndef SDT
@@ -24,6 +28,26 @@ u8 rx_buffer[MAX_PKT_LEN] __attribute__((aligned(8)));
 #define TX_BUFFER_BASE ((void *)&tx_buffer[0])
 #define RX_BUFFER_BASE ((void *)&rx_buffer[0])
 
+/* Every sample is a bf16 value, inputs are a ramp over [INPUT_MIN, INPUT_MAX] */
+#define SAMPLE_COUNT (MAX_PKT_LEN / sizeof(u16))
+#define INPUT_MIN    (-8.0f)
+#define INPUT_MAX    (8.0f)
+
+/* Must match the OUTPUT_FORMAT parameter of axis_sigmoid in the block design. Reduced precision formats pack several
+ * results into every beat (M_AXIS_WIDTH = 32 and a 32-bit S2MM stream on the DMA), so fewer bytes come back
+ */
+#ifndef SIGMOID_OUTPUT_FORMAT
+    #define SIGMOID_OUTPUT_FORMAT SIGMOID_FORMAT_BF16
+#endif
+
+#define RX_BYTES (SAMPLE_COUNT * sigmoid_output_bytes(SIGMOID_OUTPUT_FORMAT))
+
+/* Samples are converted between float and bf16 in chunks of this size */
+#define CONVERT_CHUNK_LEN 1024
+
+float convert_chunk_in[CONVERT_CHUNK_LEN];
+float convert_chunk_out[CONVERT_CHUNK_LEN];
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -41,7 +65,6 @@ int SigmoidDma_SimplePollExample(UINTPTR BaseAddress);
 XAxiDma AxiDma;
 
 /************************** Function Definitions **************************/
-#include <math.h>
 float sigmoidf(float n)
 {
     return (1 / (1 + powf(2.71828182846, -n)));
@@ -82,6 +105,11 @@ int SigmoidDma_SimplePollExample(UINTPTR BaseAddress)
     unsigned        Index;
     u8             *TxBufferPtr;
     u8             *RxBufferPtr;
+    u16            *TxSamples;
+    unsigned        ChunkIndex;
+    unsigned        ChunkLen;
+    float           Error;
+    float           MaxError;
 
     /* Metrics variables */
     XTime  tStart, tEnd;
@@ -92,6 +120,7 @@ int SigmoidDma_SimplePollExample(UINTPTR BaseAddress)
 
     TxBufferPtr = (u8 *)TX_BUFFER_BASE;
     RxBufferPtr = (u8 *)RX_BUFFER_BASE;
+    TxSamples = (u16 *)TX_BUFFER_BASE;
 
     /* Initialize the XAxiDma device.
      */
@@ -125,12 +154,23 @@ int SigmoidDma_SimplePollExample(UINTPTR BaseAddress)
     XAxiDma_IntrDisable(&AxiDma, XAXIDMA_IRQ_ALL_MASK, XAXIDMA_DEVICE_TO_DMA);
     XAxiDma_IntrDisable(&AxiDma, XAXIDMA_IRQ_ALL_MASK, XAXIDMA_DMA_TO_DEVICE);
 
-    // TODO: Use something meaningful
-    for (Index = 0; Index < MAX_PKT_LEN; Index++) {
-        TxBufferPtr[Index] = 0x00;
+    /* Fill the TX buffer with bf16 inputs, generating and converting them a chunk at a time
+     */
+    for (Index = 0; Index < SAMPLE_COUNT; Index += ChunkLen) {
+        ChunkLen = (SAMPLE_COUNT - Index < CONVERT_CHUNK_LEN) ? (SAMPLE_COUNT - Index) : CONVERT_CHUNK_LEN;
+
+        for (ChunkIndex = 0; ChunkIndex < ChunkLen; ChunkIndex++) {
+            convert_chunk_in[ChunkIndex] = INPUT_MIN + (INPUT_MAX - INPUT_MIN) * (float)(Index + ChunkIndex) / (float)(SAMPLE_COUNT - 1);
+        }
+
+        f32_to_bf16_array(convert_chunk_in, &TxSamples[Index], ChunkLen);
     }
+
+    /* MAX_PKT_LEN is odd, so the last byte isn't part of any sample */
+    TxBufferPtr[MAX_PKT_LEN - 1] = 0x00;
+
     /* Flush the buffers before the DMA transfer, in case the Data Cache
-     * is enabled
+     * is enabled. The receive length is just the buffer size, the transfer ends on the last result's tlast
      */
     Xil_DCacheFlushRange((UINTPTR)TxBufferPtr, MAX_PKT_LEN);
     Xil_DCacheFlushRange((UINTPTR)RxBufferPtr, MAX_PKT_LEN);
@@ -154,7 +194,7 @@ int SigmoidDma_SimplePollExample(UINTPTR BaseAddress)
     }
 
     /*Wait till tranfer is done or 1usec * 10^6 iterations of timeout occurs*/
-    while (XAxiDma_Busy(&AxiDma, XAXIDMA_DEVICE_TO_DMA) && XAxiDma_Busy(&AxiDma, XAXIDMA_DMA_TO_DEVICE)) {
+    while (XAxiDma_Busy(&AxiDma, XAXIDMA_DEVICE_TO_DMA) || XAxiDma_Busy(&AxiDma, XAXIDMA_DMA_TO_DEVICE)) {
     }
 
     /* ------------------------------------------------ */
@@ -165,18 +205,42 @@ int SigmoidDma_SimplePollExample(UINTPTR BaseAddress)
     /* Calculate Metrics */
     /* Convert timer counts to seconds */
     time_sec = (double)(tEnd - tStart) / (double)(COUNTS_PER_SECOND);
-    total_bytes = (double)MAX_PKT_LEN;
-    mbs = 2 * (total_bytes / 1024.0 / 1024.0) / time_sec;
+    total_bytes = (double)MAX_PKT_LEN + (double)RX_BYTES;
+    mbs = (total_bytes / 1024.0 / 1024.0) / time_sec;
     ops = ((double)MAX_PKT_LEN / 1024.0 / 1024.0) / time_sec;
 
     printf("\r\nPerformance Results:\r\n");
-    printf("  Transfer Size: %lu bytes\r\n", MAX_PKT_LEN);
+    printf("  Transfer Size: %lu bytes in, %lu bytes out\r\n", MAX_PKT_LEN, (unsigned long)RX_BYTES);
     printf("  Timer Ticks:   %llu\r\n", tEnd - tStart);
     printf("  Total Time:    %.3f s\r\n", time_sec);
     printf("  Total Time:    %.1f us\r\n", time_sec * 1000000);
     printf("  Throughput:    %.3f MB/s\r\n", mbs);
     printf("  Operations:    %.1f MOps/s\r\n", ops);
 
+    /* Check the results against the software sigmoid, converting them back a chunk at a time
+     */
+    Xil_DCacheInvalidateRange((UINTPTR)RxBufferPtr, RX_BYTES);
+    MaxError = 0.0f;
+
+    for (Index = 0; Index < SAMPLE_COUNT; Index += ChunkLen) {
+        ChunkLen = (SAMPLE_COUNT - Index < CONVERT_CHUNK_LEN) ? (SAMPLE_COUNT - Index) : CONVERT_CHUNK_LEN;
+
+        bf16_to_f32_array(&TxSamples[Index], convert_chunk_in, ChunkLen);
+        sigmoid_output_to_f32_array(SIGMOID_OUTPUT_FORMAT, RxBufferPtr + Index * sigmoid_output_bytes(SIGMOID_OUTPUT_FORMAT), convert_chunk_out,
+                                    ChunkLen);
+
+        for (ChunkIndex = 0; ChunkIndex < ChunkLen; ChunkIndex++) {
+            Error = fabsf(convert_chunk_out[ChunkIndex] - sigmoidf(convert_chunk_in[ChunkIndex]));
+            if (Error > MaxError) {
+                MaxError = Error;
+            }
+        }
+    }
+
+    printf("\r\nAccuracy Results:\r\n");
+    printf("  Samples:       %lu\r\n", SAMPLE_COUNT);
+    printf("  Max abs error: %.6f\r\n", MaxError);
+
     /* Test finishes successfully */
     return XST_SUCCESS;
 }
\ No newline at end of file
@@ -0,0 +1,78 @@
+#ifndef SIGMOID_OUTPUT_H
+#define SIGMOID_OUTPUT_H
+
+#include <math.h>
+#include <stddef.h>
+
+#include "bf16.h"
+#include "xil_types.h"
+
+/* Output formats of axis_sigmoid, selected by its OUTPUT_FORMAT parameter. Codes match SIGMOID_FORMAT_* in rtl/sigmoid_pkg.sv
+ * Results are packed into the output beats back to back, so once the DMA writes them out they're a plain array of u8
+ * (UQ0.8, FP8) or u16 (bf16, UQ0.16) in the order the inputs were sent. Decoding matches OutputFormat::toDouble in the
+ * C++ testbench
+ */
+#define SIGMOID_FORMAT_BF16     0
+#define SIGMOID_FORMAT_UQ0_8    1 /* Unsigned fixed point, value = code / 2^8 */
+#define SIGMOID_FORMAT_UQ0_16   2 /* Unsigned fixed point, value = code / 2^16 */
+#define SIGMOID_FORMAT_FP8_E4M3 3 /* OCP FP8: 4 exponent bits, 3 mantissa bits */
+#define SIGMOID_FORMAT_FP8_E5M2 4 /* OCP FP8: 5 exponent bits, 2 mantissa bits */
+
+/* Bytes per result in memory */
+static inline size_t sigmoid_output_bytes(int format)
+{
+    return (format == SIGMOID_FORMAT_BF16 || format == SIGMOID_FORMAT_UQ0_16) ? 2 : 1;
+}
+
+static inline float sigmoid_output_to_f32(int format, u16 code)
+{
+    int   fraction_bits, bias, exponent;
+    u32   mantissa;
+    float sign;
+
+    switch (format) {
+    case SIGMOID_FORMAT_BF16:
+        return bf16_to_f32(code);
+    case SIGMOID_FORMAT_UQ0_8:
+        return ldexpf((float)code, -8);
+    case SIGMOID_FORMAT_UQ0_16:
+        return ldexpf((float)code, -16);
+    default:
+        break;
+    }
+
+    fraction_bits = (format == SIGMOID_FORMAT_FP8_E4M3) ? 3 : 2;
+    bias = (format == SIGMOID_FORMAT_FP8_E4M3) ? 7 : 15;
+    exponent = (code & 0x7F) >> fraction_bits;
+    mantissa = code & ((1u << fraction_bits) - 1);
+    sign = (code & 0x80) ? -1.0f : 1.0f;
+
+    if (format == SIGMOID_FORMAT_FP8_E4M3 && (code & 0x7F) == 0x7F) {
+        return NAN;
+    }
+
+    if (format == SIGMOID_FORMAT_FP8_E5M2 && exponent == 0x1F) {
+        return mantissa ? NAN : sign * INFINITY;
+    }
+
+    if (exponent == 0) {
+        /* Subnormal */
+        return sign * ldexpf((float)mantissa, 1 - bias - fraction_bits);
+    }
+
+    return sign * ldexpf((float)(mantissa | (1u << fraction_bits)), exponent - bias - fraction_bits);
+}
+
+/* Decode count results from a received buffer */
+static inline void sigmoid_output_to_f32_array(int format, const void *input, float *output, size_t count)
+{
+    const u8  *bytes = (const u8 *)input;
+    const u16 *halves = (const u16 *)input;
+    size_t     i;
+
+    for (i = 0; i < count; i++) {
+        output[i] = sigmoid_output_to_f32(format, (sigmoid_output_bytes(format) == 2) ? halves[i] : bytes[i]);
+    }
+}
+
+#endif /* SIGMOID_OUTPUT_H */